@@ -0,0 +1,77 @@
+/**
+ *  @file libcomp/graph/apsp_johnson.hpp
+ */
+#pragma once
+#include <vector>
+#include <limits>
+#include "libcomp/math/matrix.hpp"
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/sssp_bellman_ford.hpp"
+#include "libcomp/graph/sssp_dijkstra.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup apsp_johnson APSP (Johnson)
+ *  @brief    Johnson 法による全点対最短路
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief ジョンソン法による全点対最短路
+ *
+ *  全頂点へ重み 0 の辺を張った仮想的な始点からの最短路を
+ *  sssp_bellman_ford で求めてポテンシャルとし、
+ *  辺の重みを非負に付け替えた上で各頂点から sssp_dijkstra を行う。
+ *  疎なグラフでは apsp_floyd_warshall より高速である。
+ *    - 時間計算量: \f$ O(|V| |E| \log{|V|}) \f$
+ *
+ *  @tparam    EdgeType  辺データ型
+ *  @param[in] graph     グラフデータ
+ *  @return    各頂点対の最短路の距離。到達できない場合は
+ *             std::numeric_limits の max()。
+ *             負閉路を含む場合は空の行列を返す。
+ */
+template <typename EdgeType>
+auto apsp_johnson(const AdjacencyList<EdgeType> &graph)
+	-> Matrix<decltype(EdgeType().weight)>
+{
+	typedef decltype(EdgeType().weight) weight_type;
+	typedef EdgeWithWeight<weight_type> edge_type;
+	const auto inf = std::numeric_limits<weight_type>::max();
+	const int n = graph.size();
+	AdjacencyList<edge_type> augmented(n + 1);
+	for(int u = 0; u < n; ++u){
+		for(const auto &e : graph[u]){ augmented.add_edge(u, e.to, e.weight); }
+		augmented.add_edge(n, u, weight_type());
+	}
+	const auto potential = sssp_bellman_ford(n, augmented);
+	if(potential.empty()){ return Matrix<weight_type>(); }
+	AdjacencyList<edge_type> reweighted(n);
+	for(int u = 0; u < n; ++u){
+		for(const auto &e : graph[u]){
+			const auto w = e.weight + potential[u] - potential[e.to];
+			reweighted.add_edge(u, e.to, w);
+		}
+	}
+	Matrix<weight_type> result(n, n);
+	for(int s = 0; s < n; ++s){
+		const auto dist = sssp_dijkstra(s, reweighted);
+		for(int t = 0; t < n; ++t){
+			if(dist[t] >= inf){
+				result(s, t) = inf;
+			}else{
+				result(s, t) = dist[t] - potential[s] + potential[t];
+			}
+		}
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,196 @@
+/**
+ *  @file libcomp/graph/breadth_first_search.hpp
+ */
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup breadth_first_search Breadth first search
+ *  @brief    幅優先探索
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 幅優先探索
+ *
+ *  距離テーブルと訪問順を保持し、複数回の探索で使いまわす。
+ *  2回目以降の探索では直前に訪問した頂点のみを初期化するため、
+ *  小さな連結成分を何度も探索する場合でも \f$ O(|V|) \f$ の初期化は発生しない。
+ */
+class BreadthFirstSearch {
+
+private:
+	std::vector<int> m_distance;
+	std::vector<int> m_order;
+	std::vector<uint64_t> m_frontier;
+
+	void reset(int n, int source){
+		if(static_cast<int>(m_distance.size()) != n){
+			m_distance.assign(n, -1);
+		}else{
+			for(const int v : m_order){ m_distance[v] = -1; }
+		}
+		m_order.clear();
+		m_distance[source] = 0;
+		m_order.push_back(source);
+	}
+
+	struct AlwaysTrue {
+		template <class EdgeType>
+		bool operator()(const EdgeType &) const { return true; }
+	};
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	BreadthFirstSearch()
+		: m_distance()
+		, m_order()
+		, m_frontier()
+	{ }
+
+	/**
+	 *  @brief 条件を満たす辺のみを用いた幅優先探索
+	 *    - 時間計算量: \f$ O(|V| + |E|) \f$
+	 *
+	 *  @param[in] graph   グラフデータ
+	 *  @param[in] source  始点となる頂点
+	 *  @param[in] pred    辺を通ることができるかを判定する関数オブジェクト
+	 *  @param[in] target  この頂点に到達した時点で探索を打ち切る。
+	 *                     負の場合は打ち切らない。
+	 */
+	template <class EdgeType, class Predicate>
+	void run(
+		const AdjacencyList<EdgeType> &graph, int source, Predicate pred,
+		int target = -1)
+	{
+		reset(graph.size(), source);
+		if(source == target){ return; }
+		for(size_t head = 0; head < m_order.size(); ++head){
+			const int u = m_order[head];
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				if(m_distance[v] >= 0 || !pred(e)){ continue; }
+				m_distance[v] = m_distance[u] + 1;
+				m_order.push_back(v);
+				if(v == target){ return; }
+			}
+		}
+	}
+
+	/**
+	 *  @brief 幅優先探索
+	 *    - 時間計算量: \f$ O(|V| + |E|) \f$
+	 *
+	 *  @param[in] graph   グラフデータ
+	 *  @param[in] source  始点となる頂点
+	 */
+	template <class EdgeType>
+	void run(const AdjacencyList<EdgeType> &graph, int source){
+		run(graph, source, AlwaysTrue());
+	}
+
+	/**
+	 *  @brief 無向グラフに対する方向最適化幅優先探索
+	 *
+	 *  フロンティアから出る辺が未訪問頂点の辺に比べて十分多くなった場合は
+	 *  ビット列で表したフロンティアに対して未訪問頂点側から親を探す
+	 *  (bottom-up)。フロンティアが十分小さくなった場合は通常の探索に戻る。
+	 *  各辺が両方向に追加されているグラフにのみ適用できる。
+	 *    - 時間計算量: \f$ O(|V| + |E|) \f$ (bottom-up の段数分の
+	 *      \f$ O(|V|) \f$ を除く)
+	 *
+	 *  @param[in] graph   各辺が両方向に追加されているグラフデータ
+	 *  @param[in] source  始点となる頂点
+	 */
+	template <class EdgeType>
+	void run_symmetric(const AdjacencyList<EdgeType> &graph, int source){
+		const int n = graph.size();
+		const long long alpha = 14, beta = 24;
+		reset(n, source);
+		m_frontier.assign((n + 63) / 64, 0);
+		long long unexplored = 0;
+		for(int u = 0; u < n; ++u){ unexplored += graph[u].size(); }
+		bool bottom_up = false;
+		int first = 0, last = 1;
+		for(int level = 0; first < last; ++level){
+			long long frontier_edges = 0;
+			for(int i = first; i < last; ++i){
+				frontier_edges += graph[m_order[i]].size();
+			}
+			unexplored -= frontier_edges;
+			const int frontier_size = last - first;
+			if(!bottom_up && frontier_edges > unexplored / alpha){
+				bottom_up = true;
+			}else if(bottom_up && frontier_size < n / beta){
+				bottom_up = false;
+			}
+			if(bottom_up){
+				for(int i = first; i < last; ++i){
+					const int u = m_order[i];
+					m_frontier[u >> 6] |= (1ull << (u & 63));
+				}
+				for(int v = 0; v < n; ++v){
+					if(m_distance[v] >= 0){ continue; }
+					for(const auto &e : graph[v]){
+						const int u = e.to;
+						if(!(m_frontier[u >> 6] & (1ull << (u & 63)))){
+							continue;
+						}
+						m_distance[v] = level + 1;
+						m_order.push_back(v);
+						break;
+					}
+				}
+				for(int i = first; i < last; ++i){
+					m_frontier[m_order[i] >> 6] = 0;
+				}
+			}else{
+				for(int i = first; i < last; ++i){
+					const int u = m_order[i];
+					for(const auto &e : graph[u]){
+						const int v = e.to;
+						if(m_distance[v] >= 0){ continue; }
+						m_distance[v] = level + 1;
+						m_order.push_back(v);
+					}
+				}
+			}
+			first = last;
+			last = m_order.size();
+		}
+	}
+
+	/**
+	 *  @brief 始点からの距離の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    直前の探索における始点から v への距離。
+	 *             到達しなかった場合は -1。
+	 */
+	int distance(int v) const { return m_distance[v]; }
+
+	/**
+	 *  @brief  距離テーブルの取得
+	 *  @return 直前の探索における始点から各頂点への距離のテーブル
+	 */
+	const std::vector<int> &distances() const { return m_distance; }
+
+	/**
+	 *  @brief  訪問順の取得
+	 *  @return 直前の探索で訪問した頂点の列。距離の昇順に並ぶ。
+	 */
+	const std::vector<int> &order() const { return m_order; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,430 @@
+/**
+ *  @file libcomp/graph/centroid_decomposition.hpp
+ */
+#pragma once
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup centroid_decomposition Centroid decomposition
+ *  @brief    重心分解
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 重心分解
+ *
+ *  再帰を用いずに重心分解を行い、各頂点について重心木上の祖先と
+ *  その祖先までの距離を段ごとに一つの配列に並べて保持する。
+ *  また各重心について、担当する部分木の頂点への距離をソートしたものを保持し、
+ *  距離が一定以下の頂点数の数え上げに用いる。
+ *  森が与えられた場合は連結成分ごとに独立した重心木を構築する。
+ *
+ *  @tparam EdgeType  辺データ型。weight を持つもの。
+ */
+template <class EdgeType>
+class CentroidDecomposition {
+
+public:
+	/// 距離の型
+	typedef decltype(EdgeType().weight) weight_type;
+
+private:
+	std::vector<int> m_parent;
+	std::vector<int> m_level;
+	std::vector<int> m_offset;
+	std::vector<int> m_ancestor;
+	std::vector<weight_type> m_distance;
+	std::vector<int> m_first;
+	std::vector<int> m_last;
+	std::vector<int> m_parent_first;
+	std::vector<weight_type> m_sorted;
+	std::vector<weight_type> m_sorted_parent;
+
+	static long long count_not_greater(
+		const weight_type *first, const weight_type *last,
+		const weight_type &k)
+	{
+		return std::upper_bound(first, last, k) - first;
+	}
+
+	static long long count_pairs(
+		const weight_type *first, const weight_type *last,
+		const weight_type &k)
+	{
+		long long count = 0;
+		int i = 0, j = static_cast<int>(last - first) - 1;
+		while(i < j){
+			if(k < first[i] + first[j]){
+				--j;
+			}else{
+				count += j - i;
+				++i;
+			}
+		}
+		return count;
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	CentroidDecomposition()
+		: m_parent()
+		, m_level()
+		, m_offset()
+		, m_ancestor()
+		, m_distance()
+		, m_first()
+		, m_last()
+		, m_parent_first()
+		, m_sorted()
+		, m_sorted_parent()
+	{ }
+
+	/**
+	 *  @brief 重心分解
+	 *    - 時間計算量: \f$ O(|V| \log{|V|}) \f$
+	 *  @param[in] graph  森のグラフデータ。各辺は両方向に追加されていること。
+	 */
+	explicit CentroidDecomposition(const AdjacencyList<EdgeType> &graph)
+		: m_parent(graph.size(), -1)
+		, m_level(graph.size(), -1)
+		, m_offset(graph.size() + 1, 0)
+		, m_ancestor()
+		, m_distance()
+		, m_first(graph.size())
+		, m_last(graph.size())
+		, m_parent_first(graph.size(), 0)
+		, m_sorted()
+		, m_sorted_parent()
+	{
+		const int n = graph.size();
+		std::vector<int> tree_parent(n, -1), subtree_size(n), order;
+		std::vector<int> component_parent(n), branch(n), cursor(n);
+		std::vector<int> record_vertex;
+		std::vector<weight_type> depth(n), record_distance;
+		std::vector<int> frames;
+		order.reserve(n);
+		record_vertex.reserve(n);
+		record_distance.reserve(n);
+		m_sorted.reserve(n);
+		m_sorted_parent.reserve(n);
+		for(int s = 0; s < n; ++s){
+			if(m_level[s] >= 0){ continue; }
+			order.assign(1, s);
+			tree_parent[s] = -1;
+			for(size_t head = 0; head < order.size(); ++head){
+				const int u = order[head];
+				subtree_size[u] = 1;
+				for(const auto &e : graph[u]){
+					const int v = e.to;
+					if(v == tree_parent[u]){ continue; }
+					tree_parent[v] = u;
+					order.push_back(v);
+				}
+			}
+			for(int i = static_cast<int>(order.size()) - 1; i > 0; --i){
+				const int u = order[i];
+				subtree_size[tree_parent[u]] += subtree_size[u];
+			}
+			component_parent[s] = -1;
+			frames.push_back(s);
+			while(!frames.empty()){
+				const int r = frames.back();
+				frames.pop_back();
+				const int total = subtree_size[r];
+				int c = r;
+				while(true){
+					int next = -1;
+					for(const auto &e : graph[c]){
+						const int v = e.to;
+						if(v == tree_parent[c] || m_level[v] >= 0){ continue; }
+						if(subtree_size[v] * 2 > total){ next = v; break; }
+					}
+					if(next < 0){ break; }
+					c = next;
+				}
+				const int p = component_parent[r];
+				m_parent[c] = p;
+				m_level[c] = (p < 0 ? 0 : m_level[p] + 1);
+				m_parent_first[c] = m_parent_first[r];
+				m_first[c] = m_sorted.size();
+				order.assign(1, c);
+				tree_parent[c] = -1;
+				depth[c] = weight_type();
+				for(size_t head = 0; head < order.size(); ++head){
+					const int u = order[head];
+					record_vertex.push_back(u);
+					record_distance.push_back(depth[u]);
+					m_sorted.push_back(depth[u]);
+					subtree_size[u] = 1;
+					for(const auto &e : graph[u]){
+						const int v = e.to;
+						if(v == tree_parent[u] || m_level[v] >= 0){ continue; }
+						tree_parent[v] = u;
+						branch[v] = (u == c ? v : branch[u]);
+						depth[v] = depth[u] + e.weight;
+						order.push_back(v);
+					}
+				}
+				m_last[c] = m_sorted.size();
+				const int k = order.size();
+				for(int i = k - 1; i > 0; --i){
+					const int u = order[i];
+					subtree_size[tree_parent[u]] += subtree_size[u];
+				}
+				int next_first = m_sorted_parent.size();
+				m_sorted_parent.resize(next_first + k - 1);
+				for(const auto &e : graph[c]){
+					const int v = e.to;
+					if(m_level[v] >= 0){ continue; }
+					component_parent[v] = c;
+					m_parent_first[v] = cursor[v] = next_first;
+					next_first += subtree_size[v];
+					frames.push_back(v);
+				}
+				for(int i = 1; i < k; ++i){
+					const int u = order[i];
+					m_sorted_parent[cursor[branch[u]]++] = depth[u];
+				}
+				std::sort(m_sorted.begin() + m_first[c], m_sorted.end());
+				for(const auto &e : graph[c]){
+					const int v = e.to;
+					if(m_level[v] >= 0){ continue; }
+					std::sort(m_sorted_parent.begin() + m_parent_first[v],
+					          m_sorted_parent.begin() + cursor[v]);
+				}
+			}
+		}
+		for(int v = 0; v < n; ++v){
+			m_offset[v + 1] = m_offset[v] + m_level[v] + 1;
+		}
+		m_ancestor.resize(m_offset[n]);
+		m_distance.resize(m_offset[n]);
+		for(int c = 0; c < n; ++c){
+			for(int i = m_first[c]; i < m_last[c]; ++i){
+				const int k = m_offset[record_vertex[i]] + m_level[c];
+				m_ancestor[k] = c;
+				m_distance[k] = record_distance[i];
+			}
+		}
+	}
+
+	/**
+	 *  @brief  頂点数の取得
+	 *  @return 分解したグラフの頂点数
+	 */
+	int size() const { return m_parent.size(); }
+
+	/**
+	 *  @brief 重心木上の親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    重心木における v の親。v が重心木の根の場合は -1。
+	 */
+	int parent(int v) const { return m_parent[v]; }
+
+	/**
+	 *  @brief 重心木上の深さの取得
+	 *  @param[in] v  頂点番号
+	 *  @return    重心木における v の深さ。根は 0。
+	 */
+	int level(int v) const { return m_level[v]; }
+
+	/**
+	 *  @brief 重心木上の祖先の取得
+	 *  @param[in] v  頂点番号
+	 *  @param[in] i  祖先の深さ (0 <= i <= level(v))
+	 *  @return    重心木における v の祖先のうち深さ i のもの
+	 */
+	int ancestor(int v, int i) const { return m_ancestor[m_offset[v] + i]; }
+
+	/**
+	 *  @brief 重心木上の祖先までの距離の取得
+	 *  @param[in] v  頂点番号
+	 *  @param[in] i  祖先の深さ (0 <= i <= level(v))
+	 *  @return    元の木における v から ancestor(v, i) までの距離
+	 */
+	weight_type distance(int v, int i) const {
+		return m_distance[m_offset[v] + i];
+	}
+
+	/**
+	 *  @brief 2頂点間の距離の計算
+	 *    - 時間計算量: \f$ O(\log{|V|}) \f$
+	 *  @param[in] u  頂点番号
+	 *  @param[in] v  頂点番号
+	 *  @return    元の木における u と v の距離。u と v は連結であること。
+	 */
+	weight_type distance_between(int u, int v) const {
+		int i = std::min(m_level[u], m_level[v]);
+		while(ancestor(u, i) != ancestor(v, i)){ --i; }
+		return distance(u, i) + distance(v, i);
+	}
+
+	/**
+	 *  @brief 一定距離以内の頂点の数え上げ
+	 *    - 時間計算量: \f$ O(\log^2{|V|}) \f$
+	 *  @param[in] v  頂点番号
+	 *  @param[in] k  距離の上限
+	 *  @return    v からの距離が k 以下である頂点の数 (v 自身を含む)
+	 */
+	long long count_within(int v, const weight_type &k) const {
+		long long count = 0;
+		const int depth = m_level[v];
+		for(int i = 0; i <= depth; ++i){
+			const weight_type d = distance(v, i);
+			if(k < d){ continue; }
+			const int a = ancestor(v, i);
+			const weight_type *sorted = m_sorted.data();
+			count += count_not_greater(
+				sorted + m_first[a], sorted + m_last[a], k - d);
+			if(i == depth){ continue; }
+			const int b = ancestor(v, i + 1);
+			const weight_type *sorted_parent =
+				m_sorted_parent.data() + m_parent_first[b];
+			count -= count_not_greater(
+				sorted_parent, sorted_parent + m_last[b] - m_first[b], k - d);
+		}
+		return count;
+	}
+
+	/**
+	 *  @brief 一定距離以内の頂点対の数え上げ
+	 *    - 時間計算量: \f$ O(|V| \log{|V|}) \f$
+	 *  @param[in] k  距離の上限
+	 *  @return    距離が k 以下である異なる2頂点の組 (順序なし) の数
+	 */
+	long long count_pairs_within(const weight_type &k) const {
+		const int n = size();
+		const weight_type *sorted = m_sorted.data();
+		const weight_type *sorted_parent = m_sorted_parent.data();
+		long long count = 0;
+		for(int c = 0; c < n; ++c){
+			count += count_pairs(sorted + m_first[c], sorted + m_last[c], k);
+			if(m_parent[c] < 0){ continue; }
+			const weight_type *first = sorted_parent + m_parent_first[c];
+			count -= count_pairs(first, first + m_last[c] - m_first[c], k);
+		}
+		return count;
+	}
+
+};
+
+/**
+ *  @brief 重心分解を用いた最近傍の印付き頂点の探索
+ *
+ *  各重心について、担当する部分木に含まれる印付き頂点への距離をヒープで
+ *  保持する。印を外した頂点はヒープの先頭に来た時点で取り除く。
+ *  各頂点の要素は重心ごとに高々一つとし、取り除かれる前に印を付け直した
+ *  場合は残っている要素を再利用する。
+ *
+ *  @tparam EdgeType  辺データ型。weight を持つもの。
+ */
+template <class EdgeType>
+class NearestMarkedVertex {
+
+public:
+	/// 距離の型
+	typedef decltype(EdgeType().weight) weight_type;
+
+private:
+	typedef std::pair<weight_type, int> weighted_pair;
+	typedef std::priority_queue<
+		weighted_pair, std::vector<weighted_pair>,
+		std::greater<weighted_pair>> heap_type;
+
+	const CentroidDecomposition<EdgeType> *m_decomposition;
+	std::vector<bool> m_marked;
+	// i ビット目: 深さ i の祖先のヒープに要素が残っているか
+	std::vector<uint64_t> m_in_heap;
+	std::vector<heap_type> m_heaps;
+
+public:
+	/**
+	 *  @brief コンストラクタ
+	 *
+	 *  すべての頂点に印が付いていない状態で初期化する。
+	 *  decomposition はこのオブジェクトより長く生存する必要がある。
+	 *
+	 *  @param[in] decomposition  重心分解の結果
+	 */
+	explicit NearestMarkedVertex(
+		const CentroidDecomposition<EdgeType> &decomposition)
+		: m_decomposition(&decomposition)
+		, m_marked(decomposition.size(), false)
+		, m_in_heap(decomposition.size(), 0)
+		, m_heaps(decomposition.size())
+	{ }
+
+	/**
+	 *  @brief 頂点に印を付ける
+	 *    - 時間計算量: \f$ O(\log^2{|V|}) \f$
+	 *  @param[in] v  頂点番号
+	 */
+	void mark(int v){
+		if(m_marked[v]){ return; }
+		m_marked[v] = true;
+		const auto &cd = *m_decomposition;
+		for(int i = 0; i <= cd.level(v); ++i){
+			if((m_in_heap[v] >> i) & 1){ continue; }
+			m_in_heap[v] |= (1ull << i);
+			const int a = cd.ancestor(v, i);
+			m_heaps[a].push(weighted_pair(cd.distance(v, i), v));
+		}
+	}
+
+	/**
+	 *  @brief 頂点の印を外す
+	 *    - 時間計算量: \f$ O(1) \f$ (ヒープからの除去は償却される)
+	 *  @param[in] v  頂点番号
+	 */
+	void unmark(int v){ m_marked[v] = false; }
+
+	/**
+	 *  @brief 頂点に印が付いているかの判定
+	 *  @param[in] v  頂点番号
+	 *  @return    v に印が付いていれば true
+	 */
+	bool marked(int v) const { return m_marked[v]; }
+
+	/**
+	 *  @brief 最も近い印付き頂点の探索
+	 *    - 時間計算量: \f$ O(\log^2{|V|}) \f$ (償却)
+	 *  @param[in] v  頂点番号
+	 *  @return    最も近い印付き頂点までの距離とその頂点番号の組。
+	 *             v と連結な印付き頂点が存在しない場合は頂点番号が -1 となる。
+	 */
+	weighted_pair nearest(int v){
+		const auto &cd = *m_decomposition;
+		weighted_pair best(weight_type(), -1);
+		for(int i = 0; i <= cd.level(v); ++i){
+			const int a = cd.ancestor(v, i);
+			heap_type &heap = m_heaps[a];
+			while(!heap.empty() && !m_marked[heap.top().second]){
+				m_in_heap[heap.top().second] &= ~(1ull << cd.level(a));
+				heap.pop();
+			}
+			if(heap.empty()){ continue; }
+			const weighted_pair candidate(
+				heap.top().first + cd.distance(v, i), heap.top().second);
+			if(best.second < 0 || candidate < best){ best = candidate; }
+		}
+		return best;
+	}
+
+};
+
+/**
+ *  @}
+ */
+
+}
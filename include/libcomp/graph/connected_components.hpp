@@ -3,9 +3,9 @@
  */
 #pragma once
 #include <vector>
-#include <queue>
 #include <utility>
 #include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/breadth_first_search.hpp"
 #include "libcomp/misc/coordinate_compression.hpp"
 
 namespace lc {
@@ -42,21 +42,17 @@ public:
 	{
 		const int n = graph.size();
 		int current_component = 0;
+		BreadthFirstSearch bfs;
 		for(int root = 0; root < n; ++root){
 			if(m_compress_table[root].first >= 0){ continue; }
+			// 先の成分に含まれる頂点は通らない (非対称な隣接リストへの対応)
+			bfs.run(graph, root, [this](const EdgeType &e){
+				return m_compress_table[e.to].first < 0;
+			});
 			CoordinateCompressor<int> comp;
-			std::queue<int> q;
-			q.push(root);
-			m_compress_table[root].first = current_component;
-			while(!q.empty()){
-				const int u = q.front();
-				q.pop();
+			for(const int u : bfs.order()){
+				m_compress_table[u].first = current_component;
 				comp.push(u);
-				for(const auto &e : graph[u]){
-					if(m_compress_table[e.to].first >= 0){ continue; }
-					m_compress_table[e.to].first = current_component;
-					q.push(e.to);
-				}
 			}
 			const int m = comp.build();
 			m_decompress_table.emplace_back(m);
@@ -0,0 +1,120 @@
+/**
+ *  @file libcomp/graph/enumerate_maximal_cliques.hpp
+ */
+#pragma once
+#include <vector>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/structure/dynamic_bitset.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup enumerate_maximal_cliques Enumerate maximal cliques
+ *  @brief    極大クリークの列挙
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 極大クリークの列挙 (ビット列による隣接関係)
+ *
+ *  ピボット選択を行う Bron-Kerbosch 法 (Tomita らの方法) により
+ *  極大クリークを列挙する。候補集合と除外集合をビット列で表し、
+ *  再帰を用いずに探索する。
+ *    - 時間計算量: \f$ O(3^{|V|/3}) \f$ 回の集合演算
+ *
+ *  @param[in] adjacency  各頂点の隣接頂点集合。対称で、自己ループを含まないこと。
+ *  @param[in] func       列挙された極大クリークを処理する関数オブジェクト。
+ *                        クリークに含まれる頂点の集合を DynamicBitset で受け取る。
+ */
+template <typename Func>
+void enumerate_maximal_cliques(
+	const std::vector<DynamicBitset> &adjacency, Func func)
+{
+	const int n = adjacency.size();
+	std::vector<DynamicBitset> candidates(n + 1, DynamicBitset(n));
+	std::vector<DynamicBitset> excluded(n + 1, DynamicBitset(n));
+	std::vector<DynamicBitset> branches(n + 1, DynamicBitset(n));
+	std::vector<int> position(n + 1), current(n + 1);
+	DynamicBitset clique(n);
+	auto select_branches = [&](int d){
+		const DynamicBitset &p = candidates[d], &x = excluded[d];
+		int best = -1, pivot = -1;
+		for(int u = p.find_first(); u < n; u = p.find_next(u + 1)){
+			const int c = p.count_and(adjacency[u]);
+			if(c > best){ best = c; pivot = u; }
+		}
+		for(int u = x.find_first(); u < n; u = x.find_next(u + 1)){
+			const int c = p.count_and(adjacency[u]);
+			if(c > best){ best = c; pivot = u; }
+		}
+		branches[d] = p;
+		branches[d].and_not(adjacency[pivot]);
+		position[d] = 0;
+	};
+	if(n == 0){
+		func(clique);
+		return;
+	}
+	candidates[0] = DynamicBitset(n, true);
+	select_branches(0);
+	int d = 0;
+	while(true){
+		const int v = branches[d].find_next(position[d]);
+		if(v >= n){
+			if(d == 0){ break; }
+			--d;
+			const int u = current[d];
+			clique.reset(u);
+			candidates[d].reset(u);
+			excluded[d].set(u);
+			continue;
+		}
+		position[d] = v + 1;
+		current[d] = v;
+		clique.set(v);
+		candidates[d + 1].assign_and(candidates[d], adjacency[v]);
+		excluded[d + 1].assign_and(excluded[d], adjacency[v]);
+		if(candidates[d + 1].any()){
+			select_branches(++d);
+			continue;
+		}
+		if(!excluded[d + 1].any()){ func(clique); }
+		clique.reset(v);
+		candidates[d].reset(v);
+		excluded[d].set(v);
+	}
+}
+
+/**
+ *  @brief 極大クリークの列挙
+ *
+ *  graph を無向グラフとして扱い、極大クリークを列挙する。
+ *  自己ループは無視する。
+ *    - 時間計算量: \f$ O(3^{|V|/3}) \f$ 回の集合演算
+ *
+ *  @param[in] graph  極大クリークを求める対象とするグラフ
+ *  @param[in] func   列挙された極大クリークを処理する関数オブジェクト。
+ *                    クリークに含まれる頂点の集合を DynamicBitset で受け取る。
+ */
+template <typename EdgeType, typename Func>
+void enumerate_maximal_cliques(
+	const AdjacencyList<EdgeType> &graph, Func func)
+{
+	const int n = graph.size();
+	std::vector<DynamicBitset> adjacency(n, DynamicBitset(n));
+	for(int u = 0; u < n; ++u){
+		for(const auto &e : graph[u]){
+			if(e.to == u){ continue; }
+			adjacency[u].set(e.to);
+			adjacency[e.to].set(u);
+		}
+	}
+	enumerate_maximal_cliques(adjacency, func);
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -3,10 +3,11 @@
  */
 #pragma once
 #include <vector>
-#include <functional>
 #include <cassert>
 #include <cstdint>
 #include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/enumerate_maximal_cliques.hpp"
+#include "libcomp/structure/dynamic_bitset.hpp"
 
 namespace lc {
 
@@ -18,45 +19,53 @@ namespace lc {
  */
 
 /**
- *  @brief 極大独立集合の列挙
- *    - 時間計算量: \f$ O(1.466^|V|) \f$ ?
+ *  @brief 極大独立集合の列挙 (ビット列)
+ *
+ *  graph を無向グラフとして扱い、補グラフの極大クリークとして
+ *  極大独立集合を列挙する。頂点数に制限はない。自己ループは無視する。
+ *    - 時間計算量: \f$ O(3^{|V|/3}) \f$ 回の集合演算
  *
  *  @param[in] graph  極大独立集合を求める対象とするグラフ
- *  @param[in] func   列挙された極大独立集合を処理する関数オブジェクト
+ *  @param[in] func   列挙された極大独立集合を処理する関数オブジェクト。
+ *                    集合に含まれる頂点を DynamicBitset で受け取る。
  */
 template <typename EdgeType, typename Func>
-void enumerate_maximal_independent_sets(
+void enumerate_maximal_independent_sets_dynamic(
 	const AdjacencyList<EdgeType> &graph, Func func)
 {
 	const int n = graph.size();
-	std::vector<uint64_t> bit_graph(n), incr_bit_graph(n + 1);
-	for(int i = n - 1; i >= 0; --i){
-		uint64_t mask = (1ull << i);
-		for(const auto &e : graph[i]){ mask |= (1ull << e.to); }
-		bit_graph[i] = mask;
-		incr_bit_graph[i] = mask | incr_bit_graph[i + 1];
+	std::vector<DynamicBitset> complement(n, DynamicBitset(n, true));
+	for(int u = 0; u < n; ++u){
+		complement[u].reset(u);
+		for(const auto &e : graph[u]){
+			complement[u].reset(e.to);
+			complement[e.to].reset(u);
+		}
 	}
-	std::function<void(int, uint64_t, uint64_t)> recur =
-		[&, n](int i, uint64_t picked, uint64_t eliminated) -> void {
-			if(i == n){
-				func(picked);
-				return;
-			}
-			const bool force_ignore = ((eliminated & (1ull << i)) != 0);
-			int flags = 1; // 1: select v_i, 2: ignore v_i
-			if(bit_graph[i] & ~(incr_bit_graph[i + 1] | eliminated)){
-				flags = (force_ignore ? 2 : 1);
-			}else if((incr_bit_graph[i + 1] | eliminated) & (1ull << i)){
-				flags = (force_ignore ? 2 : 3);
-			}
-			if(flags & 1){
-				recur(i + 1, picked | (1ull << i), eliminated | bit_graph[i]);
-			}
-			if(flags & 2){ recur(i + 1, picked, eliminated); }
-		};
-	recur(0, 0, 0);
+	enumerate_maximal_cliques(complement, func);
 }
 
+/**
+ *  @brief 極大独立集合の列挙
+ *
+ *  enumerate_maximal_independent_sets_dynamic() の結果を 64 ビット整数で
+ *  受け取る版。頂点数は 64 以下である必要がある。
+ *    - 時間計算量: \f$ O(3^{|V|/3}) \f$
+ *
+ *  @param[in] graph  極大独立集合を求める対象とするグラフ
+ *  @param[in] func   列挙された極大独立集合を処理する関数オブジェクト。
+ *                    i 番目のビットが頂点 i に対応する整数を受け取る。
+ */
+template <typename EdgeType, typename Func>
+void enumerate_maximal_independent_sets(
+	const AdjacencyList<EdgeType> &graph, Func func)
+{
+	assert(graph.size() <= 64);
+	enumerate_maximal_independent_sets_dynamic(
+		graph, [&](const DynamicBitset &s){
+			func(s.words().empty() ? 0ull : s.words()[0]);
+		});
+}
 
 /**
  *  @}
@@ -0,0 +1,171 @@
+/**
+ *  @file libcomp/graph/euler_tour.hpp
+ */
+#pragma once
+#include <vector>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup euler_tour Euler tour
+ *  @brief    オイラーツアーによる部分木の区間への対応付け
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief オイラーツアーによる部分木の区間への対応付け
+ *
+ *  深さ優先探索の行きがけ順に頂点を並べ、各部分木を連続した区間
+ *  [tin(v), tout(v)) に対応付ける。探索は再帰を用いずに行うため、
+ *  非常に深い木にも適用できる。
+ *  根を含む木を探索した後、訪問されていない頂点があれば
+ *  番号の小さいものから順に根として探索を続けるため、
+ *  tin は常に全頂点の置換となる。
+ */
+class EulerTour {
+
+private:
+	std::vector<int> m_tin;
+	std::vector<int> m_tout;
+	std::vector<int> m_depth;
+	std::vector<int> m_parent;
+	std::vector<int> m_order;
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	EulerTour()
+		: m_tin()
+		, m_tout()
+		, m_depth()
+		, m_parent()
+		, m_order()
+	{ }
+
+	/**
+	 *  @brief オイラーツアーの構築
+	 *    - 時間計算量: \f$ O(|V|+|E|) \f$
+	 *
+	 *  @param[in] graph  森のグラフデータ。各辺は両方向に追加されていること。
+	 *  @param[in] root   最初に探索する木の根となる頂点
+	 */
+	template <class EdgeType>
+	explicit EulerTour(const AdjacencyList<EdgeType> &graph, int root = 0)
+		: m_tin(graph.size(), -1)
+		, m_tout(graph.size())
+		, m_depth(graph.size())
+		, m_parent(graph.size(), -1)
+		, m_order()
+	{
+		const int n = graph.size();
+		std::vector<int> stack;
+		m_order.reserve(n);
+		stack.reserve(n);
+		for(int i = -1; i < n; ++i){
+			const int s = (i < 0 ? root : i);
+			if(s >= n || m_tin[s] >= 0){ continue; }
+			m_depth[s] = 0;
+			m_tin[s] = 0;
+			stack.push_back(s);
+			while(!stack.empty()){
+				const int u = stack.back();
+				stack.pop_back();
+				m_tin[u] = m_order.size();
+				m_order.push_back(u);
+				const auto &list = graph[u];
+				for(int j = static_cast<int>(list.size()) - 1; j >= 0; --j){
+					const int v = list[j].to;
+					if(m_tin[v] >= 0){ continue; }
+					m_tin[v] = 0;
+					m_parent[v] = u;
+					m_depth[v] = m_depth[u] + 1;
+					stack.push_back(v);
+				}
+			}
+		}
+		for(int j = n - 1; j >= 0; --j){
+			const int u = m_order[j];
+			if(m_tout[u] < j + 1){ m_tout[u] = j + 1; }
+			const int p = m_parent[u];
+			if(p >= 0 && m_tout[p] < m_tout[u]){ m_tout[p] = m_tout[u]; }
+		}
+	}
+
+	/**
+	 *  @brief  頂点数の取得
+	 *  @return 頂点数
+	 */
+	int size() const { return m_order.size(); }
+
+	/**
+	 *  @brief 頂点に入った時刻の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の行きがけ順での位置
+	 */
+	int tin(int v) const { return m_tin[v]; }
+
+	/**
+	 *  @brief 頂点から出た時刻の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の部分木に対応する区間の終端。
+	 *             v の部分木は [tin(v), tout(v)) に対応する。
+	 */
+	int tout(int v) const { return m_tout[v]; }
+
+	/**
+	 *  @brief 根からの深さの取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v を含む木の根から v までの辺の数
+	 */
+	int depth(int v) const { return m_depth[v]; }
+
+	/**
+	 *  @brief 親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の親の頂点番号。v が根の場合は -1。
+	 */
+	int parent(int v) const { return m_parent[v]; }
+
+	/**
+	 *  @brief 祖先関係の判定
+	 *  @param[in] u  頂点番号
+	 *  @param[in] v  頂点番号
+	 *  @return    u が v の祖先 (u = v を含む) ならば true
+	 */
+	bool is_ancestor(int u, int v) const {
+		return m_tin[u] <= m_tin[v] && m_tout[v] <= m_tout[u];
+	}
+
+	/**
+	 *  @brief 位置に対応する頂点の取得
+	 *  @param[in] i  行きがけ順での位置
+	 *  @return    行きがけ順で i 番目の頂点
+	 */
+	int vertex(int i) const { return m_order[i]; }
+
+	/**
+	 *  @brief  行きがけ順の取得
+	 *  @return 行きがけ順に並べた頂点の列
+	 */
+	const std::vector<int> &order() const { return m_order; }
+
+	/**
+	 *  @brief  頂点の並べ替えに用いる置換の取得
+	 *
+	 *  relabel_vertices() に渡すことで、行きがけ順に番号を振りなおした
+	 *  グラフが得られる。
+	 *
+	 *  @return 各頂点の行きがけ順での位置の列
+	 */
+	const std::vector<int> &permutation() const { return m_tin; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,152 @@
+/**
+ *  @file libcomp/graph/euler_tour_lowest_common_ancestor.hpp
+ */
+#pragma once
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/structure/nazo_table.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup euler_tour_lowest_common_ancestor Lowest common ancestor (Euler tour)
+ *  @brief    オイラーツアーと謎テーブルによる最近共通祖先クエリ処理
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief オイラーツアーと謎テーブルによる最近共通祖先クエリ処理
+ *
+ *  木をオイラーツアーした列上の区間最小値 (深さ, 頂点) として
+ *  最近共通祖先を求める。区間最小値には NazoTable を用いる。
+ */
+class EulerTourLowestCommonAncestor {
+
+private:
+	typedef std::pair<int, int> pii;
+
+	struct Traits {
+		typedef pii value_type;
+		value_type default_value() const {
+			return pii(std::numeric_limits<int>::max(), -1);
+		}
+		value_type operator()(const value_type &a, const value_type &b) const {
+			return std::min(a, b);
+		}
+	};
+
+	std::vector<int> m_first_index;
+	std::vector<int> m_depth_table;
+	std::vector<int> m_parent_table;
+	NazoTable<Traits> m_table;
+
+	static NazoTable<Traits> make_table(const std::vector<pii> &tour){
+		if(tour.empty()){
+			const std::vector<pii> dummy(1, Traits().default_value());
+			return NazoTable<Traits>(dummy.begin(), dummy.end());
+		}
+		return NazoTable<Traits>(tour.begin(), tour.end());
+	}
+
+	template <class EdgeType>
+	std::vector<pii> euler_tour(int root, const AdjacencyList<EdgeType> &graph){
+		const int n = graph.size();
+		std::vector<pii> tour;
+		tour.reserve(2 * n);
+		std::vector<int> stack(1, root), iteration(n, 0);
+		m_depth_table[root] = 0;
+		while(!stack.empty()){
+			const int u = stack.back();
+			if(m_first_index[u] < 0){ m_first_index[u] = tour.size(); }
+			tour.push_back(pii(m_depth_table[u], u));
+			int next = -1;
+			while(iteration[u] < static_cast<int>(graph[u].size())){
+				const int v = graph[u][iteration[u]++].to;
+				if(m_depth_table[v] >= 0){ continue; }
+				next = v;
+				break;
+			}
+			if(next >= 0){
+				m_depth_table[next] = m_depth_table[u] + 1;
+				m_parent_table[next] = u;
+				stack.push_back(next);
+			}else{
+				stack.pop_back();
+			}
+		}
+		return tour;
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	EulerTourLowestCommonAncestor()
+		: m_first_index()
+		, m_depth_table()
+		, m_parent_table()
+		, m_table(make_table(std::vector<pii>()))
+	{ }
+
+	/**
+	 *  @brief コンストラクタ
+	 *
+	 *  クエリ処理に必要なテーブルを求める。
+	 *  オイラーツアーは再帰を用いずに求める。
+	 *    - 時間計算量: \f$ O(|V| \log{|V|}) \f$
+	 *
+	 *  @tparam    EdgeType  辺データ型
+	 *  @param[in] root      木の根となる頂点の番号
+	 *  @param[in] graph     グラフデータ
+	 */
+	template <class EdgeType>
+	EulerTourLowestCommonAncestor(
+		int root, const AdjacencyList<EdgeType> &graph)
+		: m_first_index(graph.size(), -1)
+		, m_depth_table(graph.size(), -1)
+		, m_parent_table(graph.size(), -1)
+		, m_table(make_table(euler_tour(root, graph)))
+	{ }
+
+	/**
+	 *  @brief 最近共通祖先を求める
+	 *
+	 *  頂点 a, b の最近共通祖先を求める。
+	 *    - 時間計算量: \f$ O(1) \f$
+	 *
+	 *  @param[in] a  頂点番号
+	 *  @param[in] b  頂点番号
+	 *  @return    a, b の最近共通祖先の頂点番号
+	 */
+	int query(int a, int b) const {
+		int l = m_first_index[a], r = m_first_index[b];
+		if(l > r){ std::swap(l, r); }
+		if(l == r){ return a; }
+		return m_table.query(l, r + 1).second;
+	}
+
+	/**
+	 *  @brief 頂点の根からの距離を求める
+	 *  @param[in] v  頂点番号
+	 *  @return    v の根からの距離
+	 */
+	int get_depth(int v) const { return m_depth_table[v]; }
+
+	/**
+	 *  @brief 頂点の親を取得する
+	 *  @param[in] v  頂点番号
+	 *  @return    v の親の頂点番号。v が根の場合は-1。
+	 */
+	int get_parent(int v) const { return m_parent_table[v]; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
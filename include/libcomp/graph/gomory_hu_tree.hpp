@@ -0,0 +1,142 @@
+/**
+ *  @file libcomp/graph/gomory_hu_tree.hpp
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/residual_network.hpp"
+#include "libcomp/graph/maxflow_dinic.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup gomory_hu_tree Gomory-Hu tree
+ *  @brief    Gomory-Hu 木による全点対最小カット
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief  Gomory-Hu 木
+ *
+ *  Gusfield のアルゴリズムにより |V|-1 回の最大流計算で構築する。
+ *  残余グラフと最大流の作業領域は一度だけ確保し、
+ *  各計算の前には容量を初期値に戻して使いまわす。
+ *
+ *  @tparam EdgeType  辺データ型。無向グラフとして扱うため、
+ *                    各辺は両方向に追加されている必要がある。
+ */
+template <class EdgeType>
+class GomoryHuTree {
+
+public:
+	/// 容量の型
+	typedef decltype(EdgeType().capacity) capacity_type;
+
+private:
+	std::vector<int> m_parent;
+	std::vector<capacity_type> m_weight;
+	std::vector<int> m_depth;
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	GomoryHuTree()
+		: m_parent()
+		, m_weight()
+		, m_depth()
+	{ }
+
+	/**
+	 *  @brief Gomory-Hu 木の構築
+	 *    - 時間計算量: 最大流計算 |V|-1 回分
+	 *
+	 *  @param[in] graph  グラフデータ
+	 */
+	explicit GomoryHuTree(const AdjacencyList<EdgeType> &graph)
+		: m_parent(graph.size(), 0)
+		, m_weight(graph.size(), capacity_type())
+		, m_depth(graph.size(), 0)
+	{
+		const int n = graph.size();
+		ResidualAdjacencyList<EdgeType> residual = make_residual(graph);
+		std::vector<capacity_type> initial;
+		for(int u = 0; u < n; ++u){
+			for(const auto &e : residual[u]){ initial.push_back(e.capacity); }
+		}
+		MaxflowDinic<EdgeType> solver;
+		for(int s = 1; s < n; ++s){
+			const int t = m_parent[s];
+			for(int u = 0, k = 0; u < n; ++u){
+				for(auto &e : residual[u]){ e.capacity = initial[k++]; }
+			}
+			const capacity_type flow = solver.solve(s, t, residual);
+			m_weight[s] = flow;
+			for(int i = 0; i < n; ++i){
+				if(i != s && solver.level(i) >= 0 && m_parent[i] == t){
+					m_parent[i] = s;
+				}
+			}
+			if(solver.level(m_parent[t]) >= 0){
+				m_parent[s] = m_parent[t];
+				m_parent[t] = s;
+				m_weight[s] = m_weight[t];
+				m_weight[t] = flow;
+			}
+		}
+		if(n == 0){ return; }
+		m_parent[0] = -1;
+		std::vector<std::vector<int>> children(n);
+		for(int v = 1; v < n; ++v){ children[m_parent[v]].push_back(v); }
+		std::vector<int> order(1, 0);
+		for(size_t i = 0; i < order.size(); ++i){
+			const int u = order[i];
+			for(const int v : children[u]){
+				m_depth[v] = m_depth[u] + 1;
+				order.push_back(v);
+			}
+		}
+	}
+
+	/**
+	 *  @brief 木における親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の親の頂点番号。v が根の場合は -1。
+	 */
+	int parent(int v) const { return m_parent[v]; }
+
+	/**
+	 *  @brief 木の辺の重みの取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v と v の親の間の最小カットの大きさ
+	 */
+	capacity_type weight(int v) const { return m_weight[v]; }
+
+	/**
+	 *  @brief 2頂点間の最小カットの大きさの計算
+	 *    - 時間計算量: \f$ O(|V|) \f$
+	 *
+	 *  @param[in] u  頂点番号
+	 *  @param[in] v  頂点番号
+	 *  @return    u と v を分ける最小カットの大きさ
+	 */
+	capacity_type query(int u, int v) const {
+		capacity_type result = std::numeric_limits<capacity_type>::max();
+		while(u != v){
+			if(m_depth[u] < m_depth[v]){ std::swap(u, v); }
+			result = std::min(result, m_weight[u]);
+			u = m_parent[u];
+		}
+		return result;
+	}
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,290 @@
+/**
+ *  @file libcomp/graph/graph_serialization.hpp
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/edge_traits.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup graph_serialization Graph serialization
+ *  @brief    グラフのバイナリ形式での入出力
+ *  @ingroup  graph
+ *
+ *  グラフを次の順に並べたバイナリ列として読み書きする。
+ *  各値は実行環境のバイト順で格納される。
+ *    - ヘッダ: マジックナンバー、辺1本分のレコードの大きさ、
+ *      辺データ型がもつフィールドを表すフラグ、頂点数、辺数 (各 64 ビット)
+ *    - 各頂点の辺リストの開始位置 (64 ビット整数 |V|+1 個)
+ *    - 辺のレコードを始点の昇順に並べた列 (|E| 個)。
+ *      各レコードは行き先 (32 ビット整数)、重み、容量をこの順に
+ *      詰めて並べたもので、辺データ型がもたないフィールドは含まない。
+ *
+ *  レコードはフィールドごとに書き出すため、構造体のパディングは
+ *  ファイルに含まれない。その代わり to, weight, capacity 以外の
+ *  フィールドは保存されない。
+ *  ファイルをメモリマップしてそのまま参照する読み込み (ゼロコピー) は
+ *  提供せず、読み込みは常にストリームから AdjacencyList へコピーする。
+ *  @{
+ */
+
+/**
+ *  @brief バイナリ形式のヘッダに格納する辺データ型の情報と
+ *         辺のレコードへの変換
+ *  @tparam EdgeType  辺データ型
+ */
+template <typename EdgeType>
+struct BinaryGraphFormat {
+	static_assert(
+		std::is_trivially_copyable<EdgeType>::value,
+		"EdgeType must be trivially copyable");
+
+	/// マジックナンバー ("LCGRAPH" と版番号 2)
+	static const uint64_t magic = 0x024850415247434cull;
+	/// 重みをもつ場合は 1、容量をもつ場合は 2 のビットが立つフラグ
+	static const uint64_t flags =
+		(HasWeight<EdgeType>::value ? 1u : 0u) |
+		(HasCapacity<EdgeType>::value ? 2u : 0u);
+
+	/// 重みのフィールドの大きさ
+	template <typename E = EdgeType>
+	static constexpr typename std::enable_if<
+		HasWeight<E>::value, uint64_t>::type weight_size()
+	{
+		return sizeof(E().weight);
+	}
+	template <typename E = EdgeType>
+	static constexpr typename std::enable_if<
+		!HasWeight<E>::value, uint64_t>::type weight_size()
+	{
+		return 0;
+	}
+
+	/// 容量のフィールドの大きさ
+	template <typename E = EdgeType>
+	static constexpr typename std::enable_if<
+		HasCapacity<E>::value, uint64_t>::type capacity_size()
+	{
+		return sizeof(E().capacity);
+	}
+	template <typename E = EdgeType>
+	static constexpr typename std::enable_if<
+		!HasCapacity<E>::value, uint64_t>::type capacity_size()
+	{
+		return 0;
+	}
+
+	/// 辺1本分のレコードの大きさ
+	static constexpr uint64_t record_size(){
+		return sizeof(int32_t) + weight_size() + capacity_size();
+	}
+
+	/**
+	 *  @brief 辺からレコードへの変換
+	 *  @param[in]  e  変換する辺
+	 *  @param[out] p  record_size() バイトの書き込み先
+	 */
+	static void pack(const EdgeType &e, char *p){
+		const int32_t to = e.to;
+		std::memcpy(p, &to, sizeof(to));
+		pack_weight(e, p + sizeof(to));
+		pack_capacity(e, p + sizeof(to) + weight_size());
+	}
+
+	/**
+	 *  @brief レコードから辺への変換
+	 *  @param[in]  p  record_size() バイトの読み込み元
+	 *  @param[out] e  変換した辺の格納先
+	 */
+	static void unpack(const char *p, EdgeType &e){
+		int32_t to;
+		std::memcpy(&to, p, sizeof(to));
+		e.to = to;
+		unpack_weight(p + sizeof(to), e);
+		unpack_capacity(p + sizeof(to) + weight_size(), e);
+	}
+
+private:
+	template <typename E>
+	static typename std::enable_if<HasWeight<E>::value>::type
+	pack_weight(const E &e, char *p){
+		std::memcpy(p, &e.weight, sizeof(e.weight));
+	}
+	template <typename E>
+	static typename std::enable_if<!HasWeight<E>::value>::type
+	pack_weight(const E &, char *){ }
+
+	template <typename E>
+	static typename std::enable_if<HasCapacity<E>::value>::type
+	pack_capacity(const E &e, char *p){
+		std::memcpy(p, &e.capacity, sizeof(e.capacity));
+	}
+	template <typename E>
+	static typename std::enable_if<!HasCapacity<E>::value>::type
+	pack_capacity(const E &, char *){ }
+
+	template <typename E>
+	static typename std::enable_if<HasWeight<E>::value>::type
+	unpack_weight(const char *p, E &e){
+		std::memcpy(&e.weight, p, sizeof(e.weight));
+	}
+	template <typename E>
+	static typename std::enable_if<!HasWeight<E>::value>::type
+	unpack_weight(const char *, E &){ }
+
+	template <typename E>
+	static typename std::enable_if<HasCapacity<E>::value>::type
+	unpack_capacity(const char *p, E &e){
+		std::memcpy(&e.capacity, p, sizeof(e.capacity));
+	}
+	template <typename E>
+	static typename std::enable_if<!HasCapacity<E>::value>::type
+	unpack_capacity(const char *, E &){ }
+};
+
+/**
+ *  @brief グラフのバイナリ形式での書き込み
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *  @tparam    EdgeType  辺データ型。トリビアルにコピー可能であること。
+ *  @param[in] os        書き込み先のストリーム (バイナリモード)
+ *  @param[in] graph     書き込むグラフ
+ *  @return    os
+ */
+template <typename EdgeType>
+std::ostream &write_binary_graph(
+	std::ostream &os, const AdjacencyList<EdgeType> &graph)
+{
+	typedef BinaryGraphFormat<EdgeType> format_type;
+	const uint64_t record_size = format_type::record_size();
+	const int n = graph.size();
+	std::vector<uint64_t> offsets(n + 1);
+	for(int u = 0; u < n; ++u){
+		offsets[u + 1] = offsets[u] + graph[u].size();
+	}
+	const uint64_t header[] = {
+		format_type::magic, record_size, format_type::flags,
+		static_cast<uint64_t>(n), offsets[n]
+	};
+	os.write(reinterpret_cast<const char *>(header), sizeof(header));
+	os.write(
+		reinterpret_cast<const char *>(offsets.data()),
+		sizeof(uint64_t) * offsets.size());
+	std::vector<char> buffer;
+	for(int u = 0; u < n && os; ++u){
+		if(graph[u].empty()){ continue; }
+		buffer.resize(record_size * graph[u].size());
+		for(size_t i = 0; i < graph[u].size(); ++i){
+			format_type::pack(graph[u][i], &buffer[record_size * i]);
+		}
+		os.write(buffer.data(), buffer.size());
+	}
+	return os;
+}
+
+/**
+ *  @brief グラフのバイナリ形式での読み込み
+ *
+ *  ヘッダが EdgeType と一致しない場合、データが途中で終わっている場合、
+ *  辺の終点が頂点番号の範囲外の場合は is に failbit を立てて空のグラフを返す。
+ *  シーク可能なストリームでは、ヘッダが示す大きさのデータが残っているかを
+ *  読み込み前に確かめる。シークできない場合もデータは一定の大きさずつ
+ *  読み込むため、壊れたヘッダによって実際のデータ量を大きく超える
+ *  メモリを確保することはない。
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *
+ *  @tparam    EdgeType  辺データ型。書き込み時と同じ型であること。
+ *  @param[in] is        読み込み元のストリーム (バイナリモード)
+ *  @return    読み込んだグラフ
+ */
+template <typename EdgeType>
+AdjacencyList<EdgeType> read_binary_graph(std::istream &is){
+	typedef BinaryGraphFormat<EdgeType> format_type;
+	const uint64_t record_size = format_type::record_size();
+	const uint64_t chunk = 1u << 16;
+	uint64_t header[5];
+	if(!is.read(reinterpret_cast<char *>(header), sizeof(header))){
+		return AdjacencyList<EdgeType>();
+	}
+	if(header[0] != format_type::magic ||
+	   header[1] != record_size ||
+	   header[2] != format_type::flags ||
+	   header[3] >= static_cast<uint64_t>(std::numeric_limits<int>::max()))
+	{
+		is.setstate(std::ios::failbit);
+		return AdjacencyList<EdgeType>();
+	}
+	const int n = static_cast<int>(header[3]);
+	const uint64_t m = header[4], num_offsets = header[3] + 1;
+	const std::istream::pos_type start = is.tellg();
+	if(start != std::istream::pos_type(-1)){
+		if(is.seekg(0, std::ios::end)){
+			const uint64_t available = is.tellg() - start;
+			const uint64_t offsets_size = sizeof(uint64_t) * num_offsets;
+			if(available < offsets_size ||
+			   m > (available - offsets_size) / record_size)
+			{
+				is.setstate(std::ios::failbit);
+				return AdjacencyList<EdgeType>();
+			}
+		}
+		is.clear();
+		is.seekg(start);
+	}
+	std::vector<uint64_t> offsets;
+	for(uint64_t done = 0; done < num_offsets; ){
+		const uint64_t count = std::min(chunk, num_offsets - done);
+		offsets.resize(done + count);
+		if(!is.read(
+			reinterpret_cast<char *>(&offsets[done]),
+			sizeof(uint64_t) * count))
+		{
+			return AdjacencyList<EdgeType>();
+		}
+		done += count;
+	}
+	if(offsets[0] != 0 || offsets[n] != m){
+		is.setstate(std::ios::failbit);
+		return AdjacencyList<EdgeType>();
+	}
+	AdjacencyList<EdgeType> graph(n);
+	std::vector<char> buffer;
+	for(int u = 0; u < n; ++u){
+		if(offsets[u + 1] < offsets[u] || offsets[u + 1] > m){
+			is.setstate(std::ios::failbit);
+			return AdjacencyList<EdgeType>();
+		}
+		const uint64_t degree = offsets[u + 1] - offsets[u];
+		for(uint64_t done = 0; done < degree; ){
+			const uint64_t count = std::min(chunk, degree - done);
+			buffer.resize(record_size * count);
+			if(!is.read(buffer.data(), buffer.size())){
+				return AdjacencyList<EdgeType>();
+			}
+			graph[u].resize(done + count);
+			for(uint64_t i = 0; i < count; ++i){
+				EdgeType &e = graph[u][done + i];
+				format_type::unpack(&buffer[record_size * i], e);
+				if(e.to < 0 || e.to >= n){
+					is.setstate(std::ios::failbit);
+					return AdjacencyList<EdgeType>();
+				}
+			}
+			done += count;
+		}
+	}
+	return graph;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,142 @@
+/**
+ *  @file libcomp/graph/hopcroft_karp.hpp
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup hopcroft_karp Bipartite matching (Hopcroft-Karp)
+ *  @brief    Hopcroft-Karp 法による二部グラフの最大マッチング
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief  Hopcroft-Karp 法による二部グラフの最大マッチング
+ *
+ *  左側の頂点から右側の頂点への辺のみを持つ隣接リストを入力とするため、
+ *  最大流に帰着する場合と異なり始点・終点や逆辺を追加する必要がない。
+ *  増加路の探索は再帰を用いずに行う。
+ */
+class HopcroftKarp {
+
+private:
+	int m_size;
+	std::vector<int> m_left_match;
+	std::vector<int> m_right_match;
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	HopcroftKarp()
+		: m_size(0)
+		, m_left_match()
+		, m_right_match()
+	{ }
+
+	/**
+	 *  @brief 最大マッチングの計算
+	 *    - 時間計算量: \f$ O(\sqrt{|V|} |E|) \f$
+	 *
+	 *  @tparam    EdgeType    辺データ型
+	 *  @param[in] graph       左側の各頂点から右側の頂点への辺を持つグラフ
+	 *  @param[in] right_size  右側の頂点の数
+	 */
+	template <class EdgeType>
+	HopcroftKarp(const AdjacencyList<EdgeType> &graph, int right_size)
+		: m_size(0)
+		, m_left_match(graph.size(), -1)
+		, m_right_match(right_size, -1)
+	{
+		const int n = graph.size();
+		std::vector<int> dist(n), queue(n), path;
+		std::vector<size_t> iteration(n);
+		while(true){
+			int head = 0, tail = 0, limit = -1;
+			for(int u = 0; u < n; ++u){
+				if(m_left_match[u] >= 0){
+					dist[u] = -1;
+				}else{
+					dist[u] = 0;
+					queue[tail++] = u;
+				}
+			}
+			while(head < tail){
+				const int u = queue[head++];
+				if(limit >= 0 && dist[u] >= limit){ break; }
+				for(const auto &e : graph[u]){
+					const int w = m_right_match[e.to];
+					if(w < 0){
+						limit = dist[u];
+					}else if(dist[w] < 0){
+						dist[w] = dist[u] + 1;
+						queue[tail++] = w;
+					}
+				}
+			}
+			if(limit < 0){ break; }
+			std::fill(iteration.begin(), iteration.end(), 0);
+			for(int root = 0; root < n; ++root){
+				if(m_left_match[root] >= 0 || dist[root] != 0){ continue; }
+				path.assign(1, root);
+				while(!path.empty()){
+					const int u = path.back();
+					if(iteration[u] == graph[u].size()){
+						dist[u] = -1;
+						path.pop_back();
+						if(!path.empty()){ ++iteration[path.back()]; }
+						continue;
+					}
+					const int v = graph[u][iteration[u]].to;
+					const int w = m_right_match[v];
+					if(w < 0 && dist[u] == limit){
+						for(const int x : path){
+							const int y = graph[x][iteration[x]].to;
+							m_left_match[x] = y;
+							m_right_match[y] = x;
+							dist[x] = -1;
+						}
+						++m_size;
+						break;
+					}else if(w >= 0 && dist[w] == dist[u] + 1){
+						path.push_back(w);
+					}else{
+						++iteration[u];
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief  マッチングの大きさの取得
+	 *  @return 最大マッチングに含まれる辺の数
+	 */
+	int size() const { return m_size; }
+
+	/**
+	 *  @brief 左側の頂点とマッチした頂点の取得
+	 *  @param[in] u  左側の頂点番号
+	 *  @return    u とマッチした右側の頂点番号。マッチしていない場合は -1。
+	 */
+	int left_match(int u) const { return m_left_match[u]; }
+
+	/**
+	 *  @brief 右側の頂点とマッチした頂点の取得
+	 *  @param[in] v  右側の頂点番号
+	 *  @return    v とマッチした左側の頂点番号。マッチしていない場合は -1。
+	 */
+	int right_match(int v) const { return m_right_match[v]; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
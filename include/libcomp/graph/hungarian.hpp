@@ -0,0 +1,94 @@
+/**
+ *  @file libcomp/graph/hungarian.hpp
+ */
+#pragma once
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cassert>
+#include "libcomp/math/matrix.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup hungarian Assignment problem (Hungarian)
+ *  @brief    ハンガリー法による割当問題
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief ハンガリー法による割当問題
+ *
+ *  n 行 m 列 (n <= m) のコスト行列について、各行に相異なる列を割り当てる
+ *  方法のうちコストの総和が最小となるものを求める。
+ *  列ごとの値は連続した配列で持ち、内側のループは列方向の単純な走査とする。
+ *  各行の走査は分岐を含まない minv と way の更新と、最小値の探索に分ける。
+ *    - 時間計算量: \f$ O(n^2 m) \f$
+ *
+ *  @param[in] cost  コスト行列
+ *  @return    コストの総和の最小値と、各行に割り当てられた列番号の組
+ */
+template <class T>
+std::pair<T, std::vector<int>> hungarian(const Matrix<T> &cost){
+	const int n = cost.rows(), m = cost.cols();
+	assert(n <= m);
+	const T inf = std::numeric_limits<T>::max();
+	std::vector<T> u(n + 1), v(m + 1), minv(m + 1);
+	std::vector<int> p(m + 1), way(m + 1);
+	std::vector<char> used(m + 1);
+	for(int i = 1; i <= n; ++i){
+		p[0] = i;
+		int j0 = 0;
+		std::fill(minv.begin(), minv.end(), inf);
+		std::fill(used.begin(), used.end(), 0);
+		do {
+			used[j0] = 1;
+			const int i0 = p[j0];
+			const T *row = &cost(i0 - 1, 0);
+			const T ui = u[i0];
+			for(int j = 1; j <= m; ++j){
+				const T cur = row[j - 1] - ui - v[j];
+				const bool update = (used[j] == 0) & (cur < minv[j]);
+				minv[j] = update ? cur : minv[j];
+				way[j] = update ? j0 : way[j];
+			}
+			T delta = inf;
+			int j1 = 0;
+			for(int j = 1; j <= m; ++j){
+				if(!used[j] && minv[j] < delta){
+					delta = minv[j];
+					j1 = j;
+				}
+			}
+			for(int j = 0; j <= m; ++j){
+				if(used[j]){
+					u[p[j]] += delta;
+					v[j] -= delta;
+				}else{
+					minv[j] -= delta;
+				}
+			}
+			j0 = j1;
+		} while(p[j0] != 0);
+		do {
+			const int j1 = way[j0];
+			p[j0] = p[j1];
+			j0 = j1;
+		} while(j0 != 0);
+	}
+	std::vector<int> assignment(n, -1);
+	T total = T();
+	for(int j = 1; j <= m; ++j){
+		if(p[j] == 0){ continue; }
+		assignment[p[j] - 1] = j - 1;
+		total += cost(p[j] - 1, j - 1);
+	}
+	return std::make_pair(total, assignment);
+}
+
+/**
+ *  @}
+ */
+
+}
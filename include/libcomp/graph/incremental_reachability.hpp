@@ -0,0 +1,111 @@
+/**
+ *  @file libcomp/graph/incremental_reachability.hpp
+ */
+#pragma once
+#include <vector>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup incremental_reachability Incremental reachability
+ *  @brief    辺の追加に対する単一始点到達可能性の更新
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 辺の追加に対する単一始点到達可能性の更新
+ *
+ *  始点から到達可能な頂点の集合を保持する。到達可能な頂点から
+ *  到達不能な頂点への辺が追加されたときのみ、新たに到達可能になった
+ *  頂点から探索を行う。各頂点は高々一度しか到達可能にならないため、
+ *  辺の追加を何度行っても探索の合計は \f$ O(|V|+|E|) \f$ となる。
+ *
+ *  @tparam EdgeType  辺データ型
+ */
+template <typename EdgeType>
+class IncrementalReachability {
+
+private:
+	AdjacencyList<EdgeType> m_graph;
+	std::vector<bool> m_reachable;
+	std::vector<int> m_stack;
+	int m_count;
+
+	int visit(int s){
+		const int before = m_count;
+		m_reachable[s] = true;
+		++m_count;
+		m_stack.push_back(s);
+		while(!m_stack.empty()){
+			const int u = m_stack.back();
+			m_stack.pop_back();
+			for(const auto &e : m_graph[u]){
+				const int v = e.to;
+				if(m_reachable[v]){ continue; }
+				m_reachable[v] = true;
+				++m_count;
+				m_stack.push_back(v);
+			}
+		}
+		return m_count - before;
+	}
+
+public:
+	/**
+	 *  @brief 到達可能な頂点の計算
+	 *    - 時間計算量: \f$ O(|V|+|E|) \f$
+	 *  @param[in] graph   グラフデータ
+	 *  @param[in] source  始点となる頂点
+	 */
+	IncrementalReachability(const AdjacencyList<EdgeType> &graph, int source)
+		: m_graph(graph)
+		, m_reachable(graph.size(), false)
+		, m_stack()
+		, m_count(0)
+	{
+		visit(source);
+	}
+
+	/**
+	 *  @brief 辺の追加
+	 *    - 時間計算量: 新たに到達可能になった頂点とそれらから出る辺の数に比例
+	 *  @param[in] u     辺の始点
+	 *  @param[in] args  辺の情報（始点を除く）
+	 *  @return    新たに到達可能になった頂点の数
+	 */
+	template <typename... Args>
+	int add_edge(int u, Args&&... args){
+		m_graph.add_edge(u, args...);
+		const int v = m_graph[u].back().to;
+		if(!m_reachable[u] || m_reachable[v]){ return 0; }
+		return visit(v);
+	}
+
+	/**
+	 *  @brief  現在のグラフの取得
+	 *  @return 追加された辺を含むグラフ
+	 */
+	const AdjacencyList<EdgeType> &graph() const { return m_graph; }
+
+	/**
+	 *  @brief 到達可能性の判定
+	 *  @param[in] v  頂点番号
+	 *  @return    始点から v へ到達可能であれば true
+	 */
+	bool reachable(int v) const { return m_reachable[v]; }
+
+	/**
+	 *  @brief  到達可能な頂点数の取得
+	 *  @return 始点を含む、始点から到達可能な頂点の数
+	 */
+	int count() const { return m_count; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,172 @@
+/**
+ *  @file libcomp/graph/incremental_sssp.hpp
+ */
+#pragma once
+#include <vector>
+#include <queue>
+#include <limits>
+#include <utility>
+#include <functional>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup incremental_sssp Incremental SSSP
+ *  @brief    辺の追加・重みの減少に対する単一始点最短路の更新
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 辺の追加・重みの減少に対する単一始点最短路の更新
+ *
+ *  負の重みの辺を含まないグラフについて、始点からの最短距離と最短路木を保持する。
+ *  辺の追加または重みの減少によって終点の距離が縮む場合は、
+ *  その頂点のみを初期状態とした Dijkstra 法で距離が縮む頂点だけを更新する
+ *  (Ramalingam-Reps の方法のうち距離が減少する場合)。
+ *  一回の更新にかかる時間は距離が変化した頂点とそれらから出る辺の数に比例する。
+ *
+ *  @tparam EdgeType  辺データ型
+ */
+template <typename EdgeType>
+class IncrementalShortestPaths {
+
+public:
+	/// 距離の型
+	typedef decltype(EdgeType().weight) weight_type;
+
+private:
+	typedef std::pair<weight_type, int> weighted_pair;
+
+	AdjacencyList<EdgeType> m_graph;
+	std::vector<weight_type> m_distances;
+	std::vector<int> m_parents;
+	std::priority_queue<
+		weighted_pair, std::vector<weighted_pair>,
+		std::greater<weighted_pair>> m_queue;
+
+	int propagate(){
+		int count = 0;
+		while(!m_queue.empty()){
+			const auto d = m_queue.top().first;
+			const auto u = m_queue.top().second;
+			m_queue.pop();
+			if(m_distances[u] < d){ continue; }
+			++count;
+			for(const auto &e : m_graph[u]){
+				const auto v = e.to;
+				const auto t = d + e.weight;
+				if(t < m_distances[v]){
+					m_distances[v] = t;
+					m_parents[v] = u;
+					m_queue.push(std::make_pair(t, v));
+				}
+			}
+		}
+		return count;
+	}
+
+	int relax(int u, const EdgeType &e){
+		if(m_distances[u] >= std::numeric_limits<weight_type>::max()){
+			return 0;
+		}
+		const auto t = m_distances[u] + e.weight;
+		if(!(t < m_distances[e.to])){ return 0; }
+		m_distances[e.to] = t;
+		m_parents[e.to] = u;
+		m_queue.push(std::make_pair(t, e.to));
+		return propagate();
+	}
+
+public:
+	/**
+	 *  @brief 最短路の計算
+	 *    - 時間計算量: \f$ O(|E| \log |V|) \f$
+	 *  @param[in] graph   負の重みの辺を含まないグラフ
+	 *  @param[in] source  始点となる頂点
+	 */
+	IncrementalShortestPaths(const AdjacencyList<EdgeType> &graph, int source)
+		: m_graph(graph)
+		, m_distances(graph.size(), std::numeric_limits<weight_type>::max())
+		, m_parents(graph.size(), -1)
+		, m_queue()
+	{
+		m_distances[source] = weight_type();
+		m_queue.push(std::make_pair(weight_type(), source));
+		propagate();
+	}
+
+	/**
+	 *  @brief 辺の追加
+	 *    - 時間計算量: 距離が変化した頂点数を k、それらから出る辺の数を l として
+	 *      \f$ O((k + l) \log{l}) \f$
+	 *  @param[in] u     辺の始点
+	 *  @param[in] args  辺の情報（始点を除く）。重みは非負であること。
+	 *  @return    距離が変化した頂点の数
+	 */
+	template <typename... Args>
+	int add_edge(int u, Args&&... args){
+		m_graph.add_edge(u, args...);
+		return relax(u, m_graph[u].back());
+	}
+
+	/**
+	 *  @brief 辺の重みの減少
+	 *    - 時間計算量: 距離が変化した頂点数を k、それらから出る辺の数を l として
+	 *      \f$ O((k + l) \log{l}) \f$
+	 *  @param[in] u       辺の始点
+	 *  @param[in] index   graph()[u] における辺のインデックス
+	 *  @param[in] weight  新しい重み。現在の重み以下の非負の値であること。
+	 *  @return    距離が変化した頂点の数
+	 */
+	int decrease_weight(int u, int index, const weight_type &weight){
+		EdgeType &e = m_graph[u][index];
+		if(!(weight < e.weight)){ return 0; }
+		e.weight = weight;
+		return relax(u, e);
+	}
+
+	/**
+	 *  @brief  現在のグラフの取得
+	 *  @return 追加・更新された辺を含むグラフ
+	 */
+	const AdjacencyList<EdgeType> &graph() const { return m_graph; }
+
+	/**
+	 *  @brief  最短距離テーブルの取得
+	 *  @return 各頂点への最短距離。到達不能な頂点は最大値となる。
+	 */
+	const std::vector<weight_type> &distances() const { return m_distances; }
+
+	/**
+	 *  @brief 最短距離の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    始点から v への最短距離。到達不能な場合は最大値。
+	 */
+	const weight_type &distance(int v) const { return m_distances[v]; }
+
+	/**
+	 *  @brief 到達可能性の判定
+	 *  @param[in] v  頂点番号
+	 *  @return    始点から v へ到達可能であれば true
+	 */
+	bool reachable(int v) const {
+		return m_distances[v] < std::numeric_limits<weight_type>::max();
+	}
+
+	/**
+	 *  @brief 最短路木における親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v への最短路で v の直前に通る頂点。
+	 *             始点または到達不能な頂点の場合は -1。
+	 */
+	int parent(int v) const { return m_parents[v]; }
+
+};
+
+/**
+ *  @}
+ */
+
+}
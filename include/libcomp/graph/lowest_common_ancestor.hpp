@@ -20,36 +20,27 @@ namespace lc {
 class LowestCommonAncestor {
 
 private:
+	int m_levels;
 	std::vector<int> m_depth_table;
-	std::vector<std::vector<int>> m_skip_table;
+	std::vector<int> m_skip_table;
 
-	template <class EdgeType>
-	void build_tables(
-		int u, std::vector<int> &s, const AdjacencyList<EdgeType> &graph)
-	{
-		if(m_depth_table[u] >= 0){ return; }
-		const int d = s.size(), m = m_skip_table.size();
-		for(int i = 0, j = 1; i < m && j <= d; ++i, j += j){
-			m_skip_table[u][i] = s[d - j];
-		}
-		m_depth_table[u] = d;
-		s.push_back(u);
-		for(size_t i = 0; i < graph[u].size(); ++i){
-			build_tables(graph[u][i].to, s, graph);
-		}
-		s.pop_back();
-	}
+	int skip(int v, int i) const { return m_skip_table[v * m_levels + i]; }
 
 public:
 	/**
 	 *  @ brief デフォルトコンストラクタ
 	 */
-	LowestCommonAncestor() : m_depth_table(), m_skip_table() { }
+	LowestCommonAncestor()
+		: m_levels(0)
+		, m_depth_table()
+		, m_skip_table()
+	{ }
 
 	/**
 	 *  @brief コンストラクタ
 	 *
 	 *  クエリ処理に必要なテーブルを求める。
+	 *  テーブルは再帰を用いずに幅優先順で構築するため、深い木も扱える。
 	 *    - 時間計算量: \f$ O(|V| \log{|V|} \f$
 	 *
 	 *  @tparam    EdgeType  辺データ型
@@ -59,13 +50,26 @@ public:
 	template <class EdgeType>
 	LowestCommonAncestor(
 		int root, const AdjacencyList<EdgeType> &graph)
-		: m_depth_table(graph.size(), -1)
-		, m_skip_table(
-			graph.size(),
-			std::vector<int>(32 - __builtin_clz(graph.size()), -1))
+		: m_levels(32 - __builtin_clz(graph.size()))
+		, m_depth_table(graph.size(), -1)
+		, m_skip_table(graph.size() * m_levels, -1)
 	{
-		std::vector<int> s;
-		build_tables(root, s, graph);
+		std::vector<int> order(1, root);
+		m_depth_table[root] = 0;
+		for(size_t k = 0; k < order.size(); ++k){
+			const int u = order[k];
+			int *table = &m_skip_table[u * m_levels];
+			for(int i = 1; i < m_levels && table[i - 1] >= 0; ++i){
+				table[i] = skip(table[i - 1], i - 1);
+			}
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				if(m_depth_table[v] >= 0){ continue; }
+				m_depth_table[v] = m_depth_table[u] + 1;
+				m_skip_table[v * m_levels] = u;
+				order.push_back(v);
+			}
+		}
 	}
 
 	/**
@@ -79,21 +83,21 @@ public:
 	 *  @return    a, b の最近共通祖先の頂点番号
 	 */
 	int query(int a, int b) const {
-		const int m = m_skip_table[0].size();
+		const int m = m_levels;
 		if(m_depth_table[a] < m_depth_table[b]){ std::swap(a, b); }
 		for(int i = m - 1; i >= 0; --i){
 			if(m_depth_table[a] - (1 << i) >= m_depth_table[b]){
-				a = m_skip_table[a][i];
+				a = skip(a, i);
 			}
 		}
 		if(a == b){ return a; }
 		for(int i = m - 1; i >= 0; --i){
-			if(m_skip_table[a][i] != m_skip_table[b][i]){
-				a = m_skip_table[a][i];
-				b = m_skip_table[b][i];
+			if(skip(a, i) != skip(b, i)){
+				a = skip(a, i);
+				b = skip(b, i);
 			}
 		}
-		return m_skip_table[a][0];
+		return skip(a, 0);
 	}
 
 	/**
@@ -117,7 +121,7 @@ public:
 	 *  @return    v の親の頂点番号。v が根の場合は-1。
 	 */
 	int get_parent(int v) const {
-		return m_skip_table[v][0];
+		return skip(v, 0);
 	}
 
 };
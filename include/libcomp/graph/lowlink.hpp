@@ -0,0 +1,253 @@
+/**
+ *  @file libcomp/graph/lowlink.hpp
+ */
+#pragma once
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup lowlink Lowlink
+ *  @brief    Lowlink による橋・関節点・二重頂点連結成分の計算
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief Lowlink による橋・関節点・二重頂点連結成分の計算
+ *
+ *  各辺が両方向に追加された無向グラフに対して深さ優先探索を再帰を用いずに行い、
+ *  行きがけ順と lowlink を求める。親へ戻る辺は一本だけ読み飛ばすため、
+ *  多重辺は隣接リストのソートなしに正しく扱われる。
+ *  作業領域はすべて頂点数・辺数に比例する大きさで最初に確保する。
+ */
+class Lowlink {
+
+private:
+	std::vector<int> m_order;
+	std::vector<int> m_low;
+	std::vector<int> m_parent;
+	std::vector<int> m_parent_index;
+	std::vector<bool> m_articulation;
+	std::vector<std::pair<int, int>> m_bridges;
+	std::vector<int> m_block_offset;
+	std::vector<int> m_block_vertices;
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	Lowlink()
+		: m_order()
+		, m_low()
+		, m_parent()
+		, m_parent_index()
+		, m_articulation()
+		, m_bridges()
+		, m_block_offset(1, 0)
+		, m_block_vertices()
+	{ }
+
+	/**
+	 *  @brief Lowlink の計算
+	 *    - 時間計算量: \f$ O(|V|+|E|) \f$
+	 *  @param[in] graph  各辺が両方向に追加された無向グラフ
+	 */
+	template <class EdgeType>
+	explicit Lowlink(const AdjacencyList<EdgeType> &graph)
+		: m_order(graph.size(), -1)
+		, m_low(graph.size())
+		, m_parent(graph.size(), -1)
+		, m_parent_index(graph.size(), -1)
+		, m_articulation(graph.size(), false)
+		, m_bridges()
+		, m_block_offset(1, 0)
+		, m_block_vertices()
+	{
+		const int n = graph.size();
+		std::vector<int> iteration(n, 0), call_stack, vertex_stack;
+		std::vector<bool> skipped(n, false);
+		call_stack.reserve(n);
+		vertex_stack.reserve(n);
+		m_block_vertices.reserve(2 * n);
+		int counter = 0;
+		for(int root = 0; root < n; ++root){
+			if(m_order[root] >= 0){ continue; }
+			m_order[root] = m_low[root] = counter++;
+			call_stack.push_back(root);
+			vertex_stack.push_back(root);
+			int root_children = 0;
+			while(!call_stack.empty()){
+				const int u = call_stack.back();
+				if(iteration[u] < static_cast<int>(graph[u].size())){
+					const int i = iteration[u]++;
+					const int v = graph[u][i].to;
+					if(v == m_parent[u] && !skipped[u]){
+						skipped[u] = true;
+						continue;
+					}
+					if(m_order[v] < 0){
+						m_order[v] = m_low[v] = counter++;
+						m_parent[v] = u;
+						m_parent_index[v] = i;
+						call_stack.push_back(v);
+						vertex_stack.push_back(v);
+					}else{
+						m_low[u] = std::min(m_low[u], m_order[v]);
+					}
+					continue;
+				}
+				call_stack.pop_back();
+				const int p = m_parent[u];
+				if(p < 0){ continue; }
+				m_low[p] = std::min(m_low[p], m_low[u]);
+				if(m_low[u] > m_order[p]){
+					m_bridges.emplace_back(p, m_parent_index[u]);
+				}
+				if(m_low[u] < m_order[p]){ continue; }
+				if(p == root){
+					++root_children;
+				}else{
+					m_articulation[p] = true;
+				}
+				while(true){
+					const int w = vertex_stack.back();
+					vertex_stack.pop_back();
+					m_block_vertices.push_back(w);
+					if(w == u){ break; }
+				}
+				m_block_vertices.push_back(p);
+				m_block_offset.push_back(m_block_vertices.size());
+			}
+			if(root_children >= 2){ m_articulation[root] = true; }
+			if(root_children == 0){
+				m_block_vertices.push_back(root);
+				m_block_offset.push_back(m_block_vertices.size());
+			}
+			vertex_stack.clear();
+		}
+	}
+
+	/**
+	 *  @brief 行きがけ順の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    深さ優先探索で v を訪れた順番
+	 */
+	int order(int v) const { return m_order[v]; }
+
+	/**
+	 *  @brief lowlink の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の子孫から後退辺を高々一本通って到達できる頂点の
+	 *             行きがけ順の最小値
+	 */
+	int low(int v) const { return m_low[v]; }
+
+	/**
+	 *  @brief 深さ優先探索木上の親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の親の頂点番号。v が根の場合は -1。
+	 */
+	int parent(int v) const { return m_parent[v]; }
+
+	/**
+	 *  @brief 関節点判定
+	 *  @param[in] v  頂点番号
+	 *  @return    v が関節点であれば true
+	 */
+	bool is_articulation_point(int v) const { return m_articulation[v]; }
+
+	/**
+	 *  @brief  関節点の列挙
+	 *  @return 関節点の頂点番号の昇順の列
+	 */
+	std::vector<int> articulation_points() const {
+		std::vector<int> result;
+		for(int v = 0; v < static_cast<int>(m_articulation.size()); ++v){
+			if(m_articulation[v]){ result.push_back(v); }
+		}
+		return result;
+	}
+
+	/**
+	 *  @brief 橋判定
+	 *
+	 *  深さ優先探索木の辺 (parent(v), v) が橋であるかを判定する。
+	 *
+	 *  @param[in] v  根以外の頂点番号
+	 *  @return    v と親を結ぶ辺が橋であれば true
+	 */
+	bool is_bridge_to(int v) const {
+		return m_parent[v] >= 0 && m_low[v] > m_order[m_parent[v]];
+	}
+
+	/**
+	 *  @brief  橋の列挙
+	 *  @return 橋の列。各要素は辺の始点と graph[始点] 内でのインデックスの組。
+	 */
+	const std::vector<std::pair<int, int>> &bridges() const {
+		return m_bridges;
+	}
+
+	/**
+	 *  @brief  二重頂点連結成分 (ブロック) の数の取得
+	 *
+	 *  孤立点はそれだけで一つのブロックとして数える。
+	 *
+	 *  @return ブロックの数
+	 */
+	int block_count() const { return m_block_offset.size() - 1; }
+
+	/**
+	 *  @brief ブロックに含まれる頂点数の取得
+	 *  @param[in] b  ブロック番号
+	 *  @return    ブロック b に含まれる頂点の数
+	 */
+	int block_size(int b) const {
+		return m_block_offset[b + 1] - m_block_offset[b];
+	}
+
+	/**
+	 *  @brief ブロックに含まれる頂点の取得
+	 *  @param[in] b  ブロック番号
+	 *  @param[in] i  ブロック内でのインデックス (0 <= i < block_size(b))
+	 *  @return    ブロック b の i 番目の頂点
+	 */
+	int block_vertex(int b, int i) const {
+		return m_block_vertices[m_block_offset[b] + i];
+	}
+
+	/**
+	 *  @brief Block-cut tree の構築
+	 *
+	 *  頂点 0 から |V|-1 を元の頂点、|V| + b をブロック b に対応させ、
+	 *  各ブロックとそれに含まれる頂点を両方向の辺で結んだ森を構築する。
+	 *  関節点以外の頂点はちょうど一つのブロックに接続する葉となる。
+	 *    - 時間計算量: \f$ O(|V|) \f$
+	 *
+	 *  @return block-cut tree
+	 */
+	AdjacencyList<Edge> block_cut_tree() const {
+		const int n = m_order.size(), b = block_count();
+		AdjacencyList<Edge> result(n + b);
+		for(int k = 0; k < b; ++k){
+			for(int i = m_block_offset[k]; i < m_block_offset[k + 1]; ++i){
+				const int v = m_block_vertices[i];
+				result.add_edge(n + k, v);
+				result.add_edge(v, n + k);
+			}
+		}
+		return result;
+	}
+
+};
+
+/**
+ *  @}
+ */
+
+}
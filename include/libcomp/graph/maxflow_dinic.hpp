@@ -3,9 +3,10 @@
  */
 #pragma once
 #include <vector>
-#include <queue>
 #include <limits>
+#include <algorithm>
 #include "libcomp/graph/residual_network.hpp"
+#include "libcomp/graph/breadth_first_search.hpp"
 
 namespace lc {
 
@@ -16,67 +17,186 @@ namespace lc {
  *  @{
  */
 
+/**
+ *  @brief  Dinic法による最大流
+ *
+ *  作業領域を保持しておき、複数回の計算で使いまわすためのクラス。
+ *  ブロッキングフローは再帰を用いずに求め、増加路を流した後は
+ *  飽和した辺の直前まで戻って探索を続ける。
+ *
+ *  @tparam EdgeType  元のグラフの辺データ型
+ */
+template <class EdgeType>
+class MaxflowDinic {
+
+public:
+	/// 容量の型
+	typedef decltype(EdgeType().capacity) capacity_type;
+	/// 残余グラフの型
+	typedef ResidualAdjacencyList<EdgeType> GraphType;
+
+private:
+	BreadthFirstSearch m_bfs;
+	std::vector<size_t> m_iteration;
+	std::vector<int> m_path;
+
+	bool usable(
+		const ResidualEdge<EdgeType> &e, const capacity_type &threshold) const
+	{
+		return e.capacity > capacity_type() && !(e.capacity < threshold);
+	}
+
+	struct UsableEdge {
+		const MaxflowDinic *solver;
+		capacity_type threshold;
+		bool operator()(const ResidualEdge<EdgeType> &e) const {
+			return solver->usable(e, threshold);
+		}
+	};
+
+	bool build_level(
+		int source, int sink, const GraphType &graph,
+		const capacity_type &threshold)
+	{
+		const UsableEdge pred = { this, threshold };
+		m_bfs.run(graph, source, pred, sink);
+		return m_bfs.distance(sink) >= 0;
+	}
+
+	capacity_type blocking_flow(
+		int source, int sink, GraphType &graph,
+		const capacity_type &threshold)
+	{
+		const std::vector<int> &level = m_bfs.distances();
+		const size_t exhausted = std::numeric_limits<size_t>::max();
+		std::fill(m_iteration.begin(), m_iteration.end(), 0);
+		capacity_type flow = capacity_type();
+		m_path.assign(1, source);
+		while(!m_path.empty()){
+			const int u = m_path.back();
+			if(u == sink){
+				const int k = m_path.size() - 1;
+				capacity_type diff = std::numeric_limits<capacity_type>::max();
+				for(int i = 0; i < k; ++i){
+					const int w = m_path[i];
+					diff = std::min(diff, graph[w][m_iteration[w]].capacity);
+				}
+				int saturated = k;
+				for(int i = k - 1; i >= 0; --i){
+					const int w = m_path[i];
+					auto &e = graph[w][m_iteration[w]];
+					e.capacity -= diff;
+					graph[e.to][e.rev].capacity += diff;
+					if(!usable(e, threshold)){ saturated = i; }
+				}
+				flow += diff;
+				m_path.resize(saturated + 1);
+				continue;
+			}
+			size_t &it = m_iteration[u];
+			for(; it < graph[u].size(); ++it){
+				const auto &e = graph[u][it];
+				const int v = e.to;
+				if(level[v] == level[u] + 1 && usable(e, threshold) &&
+				   m_iteration[v] != exhausted)
+				{
+					break;
+				}
+			}
+			if(it < graph[u].size()){
+				m_path.push_back(graph[u][it].to);
+			}else{
+				// シンクへ到達できない頂点は以降の探索で読み飛ばす
+				it = exhausted;
+				m_path.pop_back();
+				if(!m_path.empty()){ ++m_iteration[m_path.back()]; }
+			}
+		}
+		return flow;
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	MaxflowDinic()
+		: m_bfs()
+		, m_iteration()
+		, m_path()
+	{ }
+
+	/**
+	 *  @brief 最大流の計算
+	 *    - 時間計算量: \f$ O(|E| |V|^2) \f$
+	 *      - 容量スケーリングを行う場合: \f$ O(|E| |V| \log{U}) \f$
+	 *
+	 *  @param[in]     source            フローの始点となる頂点
+	 *  @param[in]     sink              フローの終点となる頂点
+	 *  @param[in,out] graph             計算に使用する残余グラフ
+	 *  @param[in]     capacity_scaling  容量スケーリングを行うかどうか。
+	 *                                   容量が整数型の場合のみ指定できる。
+	 *  @return        sourceからsinkに流すことのできる最大の流量
+	 */
+	capacity_type solve(
+		int source, int sink, GraphType &graph,
+		bool capacity_scaling = false)
+	{
+		const int n = graph.size();
+		m_iteration.resize(n);
+		capacity_type threshold = capacity_type();
+		if(capacity_scaling){
+			capacity_type max_capacity = capacity_type();
+			for(int u = 0; u < n; ++u){
+				for(const auto &e : graph[u]){
+					max_capacity = std::max(max_capacity, e.capacity);
+				}
+			}
+			threshold = 1;
+			while(threshold <= max_capacity / 2){ threshold *= 2; }
+		}
+		capacity_type flow = capacity_type();
+		while(true){
+			while(build_level(source, sink, graph, threshold)){
+				flow += blocking_flow(source, sink, graph, threshold);
+			}
+			if(!(threshold > 1)){ break; }
+			threshold /= 2;
+		}
+		return flow;
+	}
+
+	/**
+	 *  @brief  直前の計算における頂点のレベルの取得
+	 *  @param[in] v  頂点番号
+	 *  @return    最後の幅優先探索における source から v への距離。
+	 *             到達できなかった場合は負の値。
+	 */
+	int level(int v) const { return m_bfs.distance(v); }
+
+};
+
 /**
  *  @brief Dinic法による最大流
  *    - 時間計算量: \f$ O(|E| |V|^2) \f$
  *      - 二部グラフの最大マッチングの場合: \f$ O(\sqrt{|V|} |E|) \f$
  *      - 辺の容量がすべて等しい場合: \f$ O(\min\{ \sqrt{|E|}, |V|^{1.5} \} |E|) \f$
+ *      - 容量スケーリングを行う場合: \f$ O(|E| |V| \log{U}) \f$
  *
- *  @param[in]     source  フローの始点となる頂点
- *  @param[in]     sink    フローの終点となる頂点
- *  @param[in,out] graph   計算に使用する残余グラフ
+ *  @param[in]     source            フローの始点となる頂点
+ *  @param[in]     sink              フローの終点となる頂点
+ *  @param[in,out] graph             計算に使用する残余グラフ
+ *  @param[in]     capacity_scaling  容量スケーリングを行うかどうか。
+ *                                   容量が整数型の場合のみ指定できる。
  *  @return        sourceからsinkに流すことのできる最大の流量
  */
 template <class EdgeType>
 auto maxflow_dinic(
-	int source, int sink, ResidualAdjacencyList<EdgeType> &graph)
+	int source, int sink, ResidualAdjacencyList<EdgeType> &graph,
+	bool capacity_scaling = false)
 	-> decltype(EdgeType().capacity)
 {
-	typedef decltype(EdgeType().capacity) capacity_type;
-	const capacity_type inf = std::numeric_limits<capacity_type>::max();
-	const int n = graph.size();
-	capacity_type flow = 0;
-	while(true){
-		std::vector<int> level(n, -1);
-		std::queue<int> q;
-		level[source] = 0;
-		q.push(source);
-		while(!q.empty()){
-			const int u = q.front();
-			q.pop();
-			for(const auto &e : graph[u]){
-				const int v = e.to;
-				if(e.capacity <= 0 || level[v] >= 0){ continue; }
-				level[v] = level[u] + 1;
-				q.push(v);
-			}
-		}
-		if(level[sink] < 0){ break; }
-		std::vector<size_t> iteration(n, 0);
-		while(true){
-			std::function<capacity_type(int, capacity_type)> dfs =
-				[&](int u, capacity_type limit) -> capacity_type {
-					if(u == sink){ return limit; }
-					for(; iteration[u] < graph[u].size(); ++iteration[u]){
-						auto &e = graph[u][iteration[u]];
-						const int v = e.to;
-						if(e.capacity <= 0 || level[u] >= level[v]){ continue; }
-						const capacity_type diff =
-							dfs(v, std::min(e.capacity, limit));
-						if(diff > 0){
-							e.capacity -= diff;
-							graph[v][e.rev].capacity += diff;
-							return diff;
-						}
-					}
-					return 0;
-				};
-			const auto f = dfs(source, inf);
-			if(f <= 0){ break; }
-			flow += f;
-		}
-	}
-	return flow;
+	MaxflowDinic<EdgeType> solver;
+	return solver.solve(source, sink, graph, capacity_scaling);
 }
 
 /**
@@ -84,4 +204,3 @@ auto maxflow_dinic(
  */
 
 }
-
@@ -0,0 +1,254 @@
+/**
+ *  @file libcomp/graph/maxflow_push_relabel.hpp
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "libcomp/graph/residual_network.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup maxflow_push_relabel Maximum flow (Push-relabel)
+ *  @brief    Highest-label push-relabel 法による最大流
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief  Highest-label push-relabel 法による最大流
+ *
+ *  高さが最大の活性頂点から順に discharge を行う。
+ *  ギャップヒューリスティックと、|V| 回の relabel ごとの
+ *  大域的な再ラベル付け (シンクからの逆向き幅優先探索) を用いる。
+ *  シンクに到達できない超過流は第2段階で始点に押し戻すため、
+ *  計算後の残余グラフは Dinic 法と同様に正しいフローを表す。
+ *  層の深いグラフでは maxflow_dinic より大幅に高速だが、シンク側の容量が
+ *  小さく大半の超過流を押し戻す場合は第2段階のために低速となる
+ *  (tools/benchmark/maxflow.cpp を参照)。
+ *
+ *  @tparam EdgeType  元のグラフの辺データ型
+ */
+template <class EdgeType>
+class MaxflowPushRelabel {
+
+public:
+	/// 容量の型
+	typedef decltype(EdgeType().capacity) capacity_type;
+	/// 残余グラフの型
+	typedef ResidualAdjacencyList<EdgeType> GraphType;
+
+private:
+	int m_limit;
+	int m_max_active;
+	int m_max_height;
+	int m_relabel_count;
+	std::vector<int> m_height;
+	std::vector<capacity_type> m_excess;
+	std::vector<size_t> m_current;
+	std::vector<int> m_active_head;
+	std::vector<int> m_active_next;
+	std::vector<int> m_all_head;
+	std::vector<int> m_all_prev;
+	std::vector<int> m_all_next;
+	std::vector<int> m_queue;
+
+	void push_active(int v){
+		const int h = m_height[v];
+		m_active_next[v] = m_active_head[h];
+		m_active_head[h] = v;
+		m_max_active = std::max(m_max_active, h);
+	}
+
+	void insert_all(int v){
+		const int h = m_height[v];
+		m_all_prev[v] = -1;
+		m_all_next[v] = m_all_head[h];
+		if(m_all_head[h] >= 0){ m_all_prev[m_all_head[h]] = v; }
+		m_all_head[h] = v;
+		m_max_height = std::max(m_max_height, h);
+	}
+
+	void erase_all(int v){
+		const int h = m_height[v];
+		if(m_all_prev[v] >= 0){
+			m_all_next[m_all_prev[v]] = m_all_next[v];
+		}else{
+			m_all_head[h] = m_all_next[v];
+		}
+		if(m_all_next[v] >= 0){ m_all_prev[m_all_next[v]] = m_all_prev[v]; }
+	}
+
+	void global_relabel(int target, int excluded, const GraphType &graph){
+		std::fill(m_height.begin(), m_height.end(), m_limit);
+		std::fill(m_active_head.begin(), m_active_head.end(), -1);
+		std::fill(m_all_head.begin(), m_all_head.end(), -1);
+		m_max_active = m_max_height = -1;
+		int head = 0, tail = 0;
+		m_height[target] = 0;
+		m_queue[tail++] = target;
+		while(head < tail){
+			const int u = m_queue[head++];
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				if(v == excluded || m_height[v] < m_limit){ continue; }
+				if(graph[v][e.rev].capacity <= capacity_type()){ continue; }
+				m_height[v] = m_height[u] + 1;
+				m_queue[tail++] = v;
+			}
+		}
+		for(int i = 0; i < tail; ++i){
+			const int v = m_queue[i];
+			m_current[v] = 0;
+			insert_all(v);
+			if(v != target && m_excess[v] > capacity_type()){ push_active(v); }
+		}
+	}
+
+	void discharge(int u, int target, GraphType &graph){
+		while(m_excess[u] > capacity_type()){
+			if(m_current[u] == graph[u].size()){
+				const int old_height = m_height[u];
+				int new_height = m_limit;
+				for(const auto &e : graph[u]){
+					if(e.capacity <= capacity_type()){ continue; }
+					new_height = std::min(new_height, m_height[e.to] + 1);
+				}
+				erase_all(u);
+				if(m_all_head[old_height] < 0){
+					for(int h = old_height + 1; h <= m_max_height; ++h){
+						for(int v = m_all_head[h]; v >= 0; v = m_all_next[v]){
+							m_height[v] = m_limit;
+						}
+						m_all_head[h] = -1;
+					}
+					m_max_height = old_height - 1;
+					m_height[u] = m_limit;
+					return;
+				}
+				m_height[u] = new_height;
+				m_current[u] = 0;
+				++m_relabel_count;
+				if(new_height >= m_limit){ return; }
+				insert_all(u);
+				continue;
+			}
+			auto &e = graph[u][m_current[u]];
+			const int v = e.to;
+			if(e.capacity > capacity_type() && m_height[u] == m_height[v] + 1){
+				const capacity_type diff = std::min(m_excess[u], e.capacity);
+				const bool activate =
+					(v != target && !(m_excess[v] > capacity_type()));
+				e.capacity -= diff;
+				graph[v][e.rev].capacity += diff;
+				m_excess[u] -= diff;
+				m_excess[v] += diff;
+				if(activate){ push_active(v); }
+			}else{
+				++m_current[u];
+			}
+		}
+	}
+
+	void run(int target, int excluded, GraphType &graph){
+		const int n = graph.size();
+		global_relabel(target, excluded, graph);
+		m_relabel_count = 0;
+		while(m_max_active >= 0){
+			const int h = m_max_active;
+			const int u = m_active_head[h];
+			if(u < 0){
+				--m_max_active;
+				continue;
+			}
+			m_active_head[h] = m_active_next[u];
+			if(m_height[u] != h){ continue; }
+			discharge(u, target, graph);
+			if(m_relabel_count >= n){
+				global_relabel(target, excluded, graph);
+				m_relabel_count = 0;
+			}
+		}
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	MaxflowPushRelabel()
+		: m_limit(0)
+		, m_max_active(-1)
+		, m_max_height(-1)
+		, m_relabel_count(0)
+		, m_height()
+		, m_excess()
+		, m_current()
+		, m_active_head()
+		, m_active_next()
+		, m_all_head()
+		, m_all_prev()
+		, m_all_next()
+		, m_queue()
+	{ }
+
+	/**
+	 *  @brief 最大流の計算
+	 *    - 時間計算量: \f$ O(|V|^2 \sqrt{|E|}) \f$
+	 *
+	 *  @param[in]     source  フローの始点となる頂点
+	 *  @param[in]     sink    フローの終点となる頂点
+	 *  @param[in,out] graph   計算に使用する残余グラフ
+	 *  @return        sourceからsinkに流すことのできる最大の流量
+	 */
+	capacity_type solve(int source, int sink, GraphType &graph){
+		const int n = graph.size();
+		if(source == sink){ return capacity_type(); }
+		m_limit = n;
+		m_height.assign(n, n);
+		m_excess.assign(n, capacity_type());
+		m_current.assign(n, 0);
+		m_active_head.assign(n + 1, -1);
+		m_active_next.assign(n, -1);
+		m_all_head.assign(n + 1, -1);
+		m_all_prev.assign(n, -1);
+		m_all_next.assign(n, -1);
+		m_queue.resize(n);
+		for(auto &e : graph[source]){
+			if(e.capacity <= capacity_type()){ continue; }
+			const capacity_type diff = e.capacity;
+			e.capacity -= diff;
+			graph[e.to][e.rev].capacity += diff;
+			m_excess[source] -= diff;
+			m_excess[e.to] += diff;
+		}
+		run(sink, source, graph);
+		const capacity_type flow = m_excess[sink];
+		run(source, sink, graph);
+		return flow;
+	}
+
+};
+
+/**
+ *  @brief Highest-label push-relabel 法による最大流
+ *    - 時間計算量: \f$ O(|V|^2 \sqrt{|E|}) \f$
+ *
+ *  @param[in]     source  フローの始点となる頂点
+ *  @param[in]     sink    フローの終点となる頂点
+ *  @param[in,out] graph   計算に使用する残余グラフ
+ *  @return        sourceからsinkに流すことのできる最大の流量
+ */
+template <class EdgeType>
+auto maxflow_push_relabel(
+	int source, int sink, ResidualAdjacencyList<EdgeType> &graph)
+	-> decltype(EdgeType().capacity)
+{
+	MaxflowPushRelabel<EdgeType> solver;
+	return solver.solve(source, sink, graph);
+}
+
+/**
+ *  @}
+ */
+
+}
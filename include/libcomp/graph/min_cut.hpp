@@ -0,0 +1,79 @@
+/**
+ *  @file libcomp/graph/min_cut.hpp
+ */
+#pragma once
+#include <vector>
+#include <utility>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/residual_network.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup min_cut Minimum cut
+ *  @brief    最大流計算後の残余グラフからの最小カットの復元
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 最小カットの始点側頂点集合の計算
+ *
+ *  最大流を流した後の残余グラフにおいて source から到達可能な頂点集合を求める。
+ *    - 時間計算量: \f$ O(|V| + |E|) \f$
+ *
+ *  @param[in] source  フローの始点とした頂点
+ *  @param[in] graph   最大流を流した後の残余グラフ
+ *  @return    各頂点が始点側に属するかどうかのテーブル
+ */
+template <class EdgeType>
+std::vector<bool> min_cut(
+	int source, const ResidualAdjacencyList<EdgeType> &graph)
+{
+	typedef decltype(EdgeType().capacity) capacity_type;
+	const int n = graph.size();
+	std::vector<bool> result(n);
+	std::vector<int> q(1, source);
+	result[source] = true;
+	for(size_t head = 0; head < q.size(); ++head){
+		const int u = q[head];
+		for(const auto &e : graph[u]){
+			if(result[e.to] || e.capacity <= capacity_type()){ continue; }
+			result[e.to] = true;
+			q.push_back(e.to);
+		}
+	}
+	return result;
+}
+
+/**
+ *  @brief カットに含まれる辺の列挙
+ *    - 時間計算量: \f$ O(|V| + |E|) \f$
+ *
+ *  @param[in] graph        残余グラフを作る前の元のグラフ
+ *  @param[in] source_side  各頂点が始点側に属するかどうかのテーブル
+ *  @return    始点側から終点側に向かう辺の列。
+ *             各要素は辺の始点と graph[始点] 内でのインデックスの組。
+ */
+template <class EdgeType>
+std::vector<std::pair<int, int>> cut_edges(
+	const AdjacencyList<EdgeType> &graph,
+	const std::vector<bool> &source_side)
+{
+	const int n = graph.size();
+	std::vector<std::pair<int, int>> result;
+	for(int u = 0; u < n; ++u){
+		if(!source_side[u]){ continue; }
+		for(size_t i = 0; i < graph[u].size(); ++i){
+			if(source_side[graph[u][i].to]){ continue; }
+			result.emplace_back(u, static_cast<int>(i));
+		}
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,221 @@
+/**
+ *  @file libcomp/graph/mincostflow_cost_scaling.hpp
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include "libcomp/graph/residual_network.hpp"
+#include "libcomp/graph/maxflow_dinic.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup mincostflow_cost_scaling Minimum cost flow (Cost scaling)
+ *  @brief    Cost scaling push-relabel 法による最小費用流
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief  Cost scaling push-relabel 法による最小費用流
+ *
+ *  流量を先に Dinic 法で求め、その量を始点の供給・終点の需要として
+ *  \f$ \varepsilon \f$ 最適性を保ちながら \f$ \varepsilon \f$ を
+ *  1/4 ずつ小さくしていく。コストを (|V|+1) 倍して扱うため、
+ *  計算量が流量に依存しない。コストは整数型である必要がある。
+ *  倍したコストとポテンシャル、コストの途中経過は long long より狭い
+ *  コストの型では long long で保持する。ポテンシャルの絶対値は
+ *  \f$ |V|^2 \max{|c|} \f$ 程度まで大きくなるため、
+ *  その値が cost_type に収まる必要がある。
+ *
+ *  @tparam EdgeType  元のグラフの辺データ型
+ */
+template <class EdgeType>
+class MincostflowCostScaling {
+
+public:
+	/// コストの型
+	typedef decltype(EdgeType().weight) weight_type;
+	/// 容量の型
+	typedef decltype(EdgeType().capacity) capacity_type;
+	/// 残余グラフの型
+	typedef ResidualAdjacencyList<EdgeType> GraphType;
+	/// 内部で倍したコストとポテンシャルに用いる型
+	typedef typename std::conditional<
+		(sizeof(weight_type) < sizeof(long long)),
+		long long, weight_type>::type cost_type;
+
+private:
+	static const int SCALING_FACTOR = 4;
+
+	std::vector<int> m_offset;
+	std::vector<cost_type> m_cost;
+	std::vector<cost_type> m_price;
+	std::vector<capacity_type> m_excess;
+	std::vector<size_t> m_current;
+	std::vector<int> m_queue;
+	std::vector<capacity_type> m_initial;
+	cost_type m_total_cost;
+
+	cost_type reduced_cost(int u, int i, const GraphType &graph) const {
+		const int v = graph[u][i].to;
+		return m_cost[m_offset[u] + i] + m_price[u] - m_price[v];
+	}
+
+	void push(int u, int i, capacity_type diff, GraphType &graph){
+		auto &e = graph[u][i];
+		e.capacity -= diff;
+		graph[e.to][e.rev].capacity += diff;
+		m_excess[u] -= diff;
+		m_excess[e.to] += diff;
+		m_total_cost += diff * static_cast<cost_type>(e.weight);
+	}
+
+	void refine(cost_type eps, GraphType &graph){
+		const int n = graph.size();
+		m_queue.clear();
+		for(int u = 0; u < n; ++u){
+			for(size_t i = 0; i < graph[u].size(); ++i){
+				const auto &e = graph[u][i];
+				if(e.capacity <= capacity_type()){ continue; }
+				if(reduced_cost(u, i, graph) < cost_type()){
+					push(u, i, e.capacity, graph);
+				}
+			}
+		}
+		for(int u = 0; u < n; ++u){
+			m_current[u] = 0;
+			if(m_excess[u] > capacity_type()){ m_queue.push_back(u); }
+		}
+		for(size_t head = 0; head < m_queue.size(); ++head){
+			const int u = m_queue[head];
+			while(m_excess[u] > capacity_type()){
+				if(m_current[u] == graph[u].size()){
+					bool found = false;
+					cost_type best = cost_type();
+					for(size_t i = 0; i < graph[u].size(); ++i){
+						const auto &e = graph[u][i];
+						if(e.capacity <= capacity_type()){ continue; }
+						const cost_type t =
+							m_price[e.to] - m_cost[m_offset[u] + i];
+						if(!found || best < t){ best = t; }
+						found = true;
+					}
+					m_price[u] = best - eps;
+					m_current[u] = 0;
+					continue;
+				}
+				const int i = m_current[u];
+				const auto &e = graph[u][i];
+				if(e.capacity > capacity_type() &&
+				   reduced_cost(u, i, graph) < cost_type())
+				{
+					const int v = e.to;
+					const bool activate = !(m_excess[v] > capacity_type());
+					push(u, i, std::min(m_excess[u], e.capacity), graph);
+					if(activate && m_excess[v] > capacity_type()){
+						m_queue.push_back(v);
+					}
+				}else{
+					++m_current[u];
+				}
+			}
+		}
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	MincostflowCostScaling()
+		: m_offset()
+		, m_cost()
+		, m_price()
+		, m_excess()
+		, m_current()
+		, m_queue()
+		, m_initial()
+		, m_total_cost()
+	{ }
+
+	/**
+	 *  @brief 最小費用流の計算
+	 *    - 時間計算量: \f$ O(|V|^2 |E| \log{(|V| C)}) \f$
+	 *
+	 *  graph に負閉路が含まれないことを仮定する。
+	 *
+	 *  @param[in]     source  フローの始点となる頂点
+	 *  @param[in]     sink    フローの終点となる頂点
+	 *  @param[in]     flow    sourceからsinkに流す量の上限
+	 *  @param[in,out] graph   計算に使用する残余グラフ
+	 *  @return        実際に流した量とそのときの最小のコストの組。
+	 *                 flow だけ流しきれない場合は流せるだけ流した結果を返す。
+	 */
+	std::pair<capacity_type, weight_type> solve(
+		int source, int sink, capacity_type flow, GraphType &graph)
+	{
+		const int n = graph.size();
+		m_initial.clear();
+		for(int u = 0; u < n; ++u){
+			for(const auto &e : graph[u]){ m_initial.push_back(e.capacity); }
+		}
+		MaxflowDinic<EdgeType> dinic;
+		flow = std::min(flow, dinic.solve(source, sink, graph));
+		m_offset.resize(n + 1);
+		m_cost.clear();
+		cost_type eps = 1;
+		for(int u = 0, k = 0; u < n; ++u){
+			m_offset[u] = k;
+			for(auto &e : graph[u]){
+				e.capacity = m_initial[k++];
+				const cost_type c = static_cast<cost_type>(e.weight) * (n + 1);
+				m_cost.push_back(c);
+				eps = std::max(eps, c < cost_type() ? -c : c);
+			}
+		}
+		m_offset[n] = m_cost.size();
+		m_price.assign(n, cost_type());
+		m_excess.assign(n, capacity_type());
+		m_current.resize(n);
+		m_total_cost = cost_type();
+		if(source == sink || !(flow > capacity_type())){
+			return std::make_pair(capacity_type(), weight_type());
+		}
+		m_excess[source] = flow;
+		m_excess[sink] = -flow;
+		do {
+			eps = std::max(cost_type(1), eps / SCALING_FACTOR);
+			refine(eps, graph);
+		} while(eps > 1);
+		return std::make_pair(flow, static_cast<weight_type>(m_total_cost));
+	}
+
+};
+
+/**
+ *  @brief Cost scaling push-relabel 法による最小費用流
+ *    - 時間計算量: \f$ O(|V|^2 |E| \log{(|V| C)}) \f$
+ *
+ *  @param[in]     source  フローの始点となる頂点
+ *  @param[in]     sink    フローの終点となる頂点
+ *  @param[in]     flow    sourceからsinkに流す量の上限
+ *  @param[in,out] graph   計算に使用する残余グラフ
+ *  @return        実際に流した量とそのときの最小のコストの組。
+ */
+template <class EdgeType>
+auto mincostflow_cost_scaling(
+	int source, int sink, decltype(EdgeType().capacity) flow,
+	ResidualAdjacencyList<EdgeType> &graph)
+	-> std::pair<decltype(EdgeType().capacity), decltype(EdgeType().weight)>
+{
+	MincostflowCostScaling<EdgeType> solver;
+	return solver.solve(source, sink, flow, graph);
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -3,9 +3,9 @@
  */
 #pragma once
 #include <vector>
-#include <queue>
 #include <limits>
 #include <algorithm>
+#include <functional>
 #include <utility>
 #include "libcomp/graph/residual_network.hpp"
 
@@ -18,6 +18,168 @@ namespace lc {
  *  @{
  */
 
+/**
+ *  @brief  Primal-Dual法による最小費用流
+ *
+ *  ポテンシャルを用いたダイクストラ法で最短路を繰り返し求める。
+ *  作業領域は保持しておき、増加路ごと・計算ごとに使いまわす。
+ *  負のコストの辺が含まれる場合は Bellman-Ford 法で初期ポテンシャルを求める。
+ *
+ *  @tparam EdgeType  元のグラフの辺データ型
+ */
+template <class EdgeType>
+class MincostflowPrimalDual {
+
+public:
+	/// コストの型
+	typedef decltype(EdgeType().weight) weight_type;
+	/// 容量の型
+	typedef decltype(EdgeType().capacity) capacity_type;
+	/// 残余グラフの型
+	typedef ResidualAdjacencyList<EdgeType> GraphType;
+
+private:
+	typedef std::pair<weight_type, int> weighted_pair;
+
+	std::vector<weight_type> m_potential;
+	std::vector<weight_type> m_dist;
+	std::vector<int> m_prev_vertex;
+	std::vector<int> m_prev_edge;
+	std::vector<weighted_pair> m_heap;
+	std::vector<bool> m_in_queue;
+	std::vector<int> m_queue;
+
+	void initialize_potential(int source, const GraphType &graph){
+		const weight_type inf = std::numeric_limits<weight_type>::max();
+		const int n = graph.size();
+		bool has_negative = false;
+		for(int u = 0; u < n; ++u){
+			for(const auto &e : graph[u]){
+				if(e.capacity > capacity_type() && e.weight < weight_type()){
+					has_negative = true;
+				}
+			}
+		}
+		std::fill(m_potential.begin(), m_potential.end(), weight_type());
+		if(!has_negative){ return; }
+		std::fill(m_potential.begin(), m_potential.end(), inf);
+		std::fill(m_in_queue.begin(), m_in_queue.end(), false);
+		m_queue.assign(1, source);
+		m_potential[source] = weight_type();
+		m_in_queue[source] = true;
+		for(size_t head = 0; head < m_queue.size(); ++head){
+			const int u = m_queue[head];
+			m_in_queue[u] = false;
+			for(const auto &e : graph[u]){
+				if(e.capacity <= capacity_type()){ continue; }
+				const weight_type t = m_potential[u] + e.weight;
+				if(!(t < m_potential[e.to])){ continue; }
+				m_potential[e.to] = t;
+				if(m_in_queue[e.to]){ continue; }
+				m_in_queue[e.to] = true;
+				m_queue.push_back(e.to);
+			}
+		}
+		for(int v = 0; v < n; ++v){
+			if(m_potential[v] == inf){ m_potential[v] = weight_type(); }
+		}
+	}
+
+	bool dijkstra(int source, int sink, const GraphType &graph){
+		const weight_type inf = std::numeric_limits<weight_type>::max();
+		const std::greater<weighted_pair> comp;
+		std::fill(m_dist.begin(), m_dist.end(), inf);
+		m_heap.clear();
+		m_dist[source] = weight_type();
+		m_heap.emplace_back(m_dist[source], source);
+		while(!m_heap.empty()){
+			std::pop_heap(m_heap.begin(), m_heap.end(), comp);
+			const weighted_pair p = m_heap.back();
+			m_heap.pop_back();
+			const int u = p.second;
+			if(m_dist[u] < p.first){ continue; }
+			for(size_t i = 0; i < graph[u].size(); ++i){
+				const auto &e = graph[u][i];
+				if(e.capacity <= capacity_type()){ continue; }
+				const int v = e.to;
+				const weight_type new_dist =
+					m_dist[u] + (e.weight + m_potential[u] - m_potential[v]);
+				if(!(new_dist < m_dist[v])){ continue; }
+				m_dist[v] = new_dist;
+				m_prev_vertex[v] = u;
+				m_prev_edge[v] = i;
+				m_heap.emplace_back(new_dist, v);
+				std::push_heap(m_heap.begin(), m_heap.end(), comp);
+			}
+		}
+		if(m_dist[sink] == inf){ return false; }
+		const int n = graph.size();
+		for(int v = 0; v < n; ++v){
+			if(m_dist[v] != inf){ m_potential[v] += m_dist[v]; }
+		}
+		return true;
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	MincostflowPrimalDual()
+		: m_potential()
+		, m_dist()
+		, m_prev_vertex()
+		, m_prev_edge()
+		, m_heap()
+		, m_in_queue()
+		, m_queue()
+	{ }
+
+	/**
+	 *  @brief 最小費用流の計算
+	 *    - 時間計算量: \f$ O(F |E| \log{|V|}) \f$
+	 *      (負のコストを含む場合は \f$ O(|V| |E|) \f$ が加わる)
+	 *
+	 *  graph に負閉路が含まれないことを仮定する。
+	 *
+	 *  @param[in]     source  フローの始点となる頂点
+	 *  @param[in]     sink    フローの終点となる頂点
+	 *  @param[in]     flow    sourceからsinkに流す量の上限
+	 *  @param[in,out] graph   計算に使用する残余グラフ
+	 *  @return        実際に流した量とそのときの最小のコストの組。
+	 *                 flow だけ流しきれない場合は流せるだけ流した結果を返す。
+	 */
+	std::pair<capacity_type, weight_type> solve(
+		int source, int sink, capacity_type flow, GraphType &graph)
+	{
+		const int n = graph.size();
+		m_potential.resize(n);
+		m_dist.resize(n);
+		m_prev_vertex.resize(n);
+		m_prev_edge.resize(n);
+		m_in_queue.resize(n);
+		initialize_potential(source, graph);
+		capacity_type total_flow = capacity_type();
+		weight_type total_cost = weight_type();
+		while(flow > capacity_type() && dijkstra(source, sink, graph)){
+			capacity_type diff = flow;
+			for(int v = sink; v != source; v = m_prev_vertex[v]){
+				diff = std::min(
+					diff, graph[m_prev_vertex[v]][m_prev_edge[v]].capacity);
+			}
+			for(int v = sink; v != source; v = m_prev_vertex[v]){
+				auto &e = graph[m_prev_vertex[v]][m_prev_edge[v]];
+				e.capacity -= diff;
+				graph[v][e.rev].capacity += diff;
+			}
+			flow -= diff;
+			total_flow += diff;
+			total_cost += diff * (m_potential[sink] - m_potential[source]);
+		}
+		return std::make_pair(total_flow, total_cost);
+	}
+
+};
+
 /**
  *  @brief Primal-Dual法による最小費用流
  *    - 時間計算量: \f$ O(F |E| \log{|V|}) \f$
@@ -35,54 +197,10 @@ auto mincostflow_primal_dual(
 	ResidualAdjacencyList<EdgeType> &graph)
 	-> decltype(EdgeType().weight)
 {
-	typedef decltype(EdgeType().weight) weight_type;
-	typedef decltype(EdgeType().capacity) capacity_type;
-	typedef std::pair<weight_type, int> weighted_pair;
-	const weight_type inf = std::numeric_limits<weight_type>::max();
-	const int n = graph.size();
-	weight_type result = 0;
-	std::vector<weight_type> h(n);
-	std::vector<int> prev_vertex(n), prev_edge(n);
-	while(flow > 0){
-		std::priority_queue<
-			weighted_pair, std::vector<weighted_pair>,
-			std::greater<weighted_pair>> pq;
-		std::vector<weight_type> dist(n, inf);
-		dist[source] = weight_type();
-		pq.push(std::make_pair(dist[source], source));
-		while(!pq.empty()){
-			weighted_pair p = pq.top();
-			pq.pop();
-			const int u = p.second;
-			if(dist[u] < p.first){ continue; }
-			for(size_t i = 0; i < graph[u].size(); ++i){
-				const auto &e = graph[u][i];
-				if(e.capacity <= 0){ continue; }
-				const int v = e.to;
-				const auto new_dist = dist[u] + e.weight + h[u] - h[v];
-				if(dist[v] <= new_dist){ continue; }
-				dist[v] = new_dist;
-				prev_vertex[v] = u;
-				prev_edge[v] = i;
-				pq.push(std::make_pair(new_dist, v));
-			}
-		}
-		if(dist[sink] >= inf){ return -1; }
-		for(int i = 0; i < n; ++i){ h[i] += dist[i]; }
-		weight_type diff = flow;
-		for(int v = sink; v != source; v = prev_vertex[v]){
-			diff = std::min(
-				diff, graph[prev_vertex[v]][prev_edge[v]].capacity);
-		}
-		flow -= diff;
-		result += diff * h[sink];
-		for(int v = sink; v != source; v = prev_vertex[v]){
-			auto &e = graph[prev_vertex[v]][prev_edge[v]];
-			e.capacity -= diff;
-			graph[v][e.rev].capacity += diff;
-		}
-	}
-	return result;
+	MincostflowPrimalDual<EdgeType> solver;
+	const auto result = solver.solve(source, sink, flow, graph);
+	if(result.first < flow){ return -1; }
+	return result.second;
 }
 
 /**
@@ -90,4 +208,3 @@ auto mincostflow_primal_dual(
  */
 
 }
-
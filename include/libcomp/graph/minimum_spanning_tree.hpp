@@ -0,0 +1,136 @@
+/**
+ *  @file libcomp/graph/minimum_spanning_tree.hpp
+ */
+#pragma once
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/structure/union_find_tree.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup minimum_spanning_tree Minimum spanning tree
+ *  @brief    最小全域木
+ *  @ingroup  graph
+ *
+ *  各関数はグラフを無向グラフとして扱い、最小全域森に含まれる辺を
+ *  辺の始点と graph[始点] 内でのインデックスの組の列として返す。
+ *  各辺は片方向のみ、両方向のどちらで追加されていてもよい。
+ *  @{
+ */
+
+/**
+ *  @brief Kruskal 法による最小全域森
+ *    - 時間計算量: \f$ O(|E| \log{|E|}) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    最小全域森に含まれる辺の列。重みの昇順に並ぶ。
+ */
+template <class EdgeType>
+std::vector<std::pair<int, int>> minimum_spanning_tree_kruskal(
+	const AdjacencyList<EdgeType> &graph)
+{
+	typedef decltype(EdgeType().weight) weight_type;
+	struct SortEntry {
+		weight_type weight;
+		int from;
+		int index;
+		bool operator<(const SortEntry &e) const { return weight < e.weight; }
+	};
+	const int n = graph.size();
+	std::vector<SortEntry> edges;
+	for(int u = 0; u < n; ++u){
+		for(size_t i = 0; i < graph[u].size(); ++i){
+			const auto &e = graph[u][i];
+			if(e.to == u){ continue; }
+			edges.push_back(SortEntry{ e.weight, u, static_cast<int>(i) });
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+	UnionFindTree uf(n);
+	std::vector<std::pair<int, int>> result;
+	for(const auto &s : edges){
+		if(static_cast<int>(result.size()) + 1 >= n){ break; }
+		const int v = graph[s.from][s.index].to;
+		if(uf.same(s.from, v)){ continue; }
+		uf.unite(s.from, v);
+		result.emplace_back(s.from, s.index);
+	}
+	return result;
+}
+
+/**
+ *  @brief Boruvka 法による最小全域森
+ *
+ *  各連結成分から出る最小の辺を同時に採用して成分を併合することを
+ *  繰り返す。各段で成分数が半分以下になる。
+ *  重みの等しい辺は (重み, 小さい方の端点, 大きい方の端点) の順で比較し、
+ *  閉路ができないようにする。各段の後に両端が同じ成分に属する辺を取り除くため、
+ *  後の段ほど走査する辺が少なくなる。
+ *    - 時間計算量: \f$ O(|E| \log{|V|}) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    最小全域森に含まれる辺の列
+ */
+template <class EdgeType>
+std::vector<std::pair<int, int>> minimum_spanning_tree_boruvka(
+	const AdjacencyList<EdgeType> &graph)
+{
+	typedef decltype(EdgeType().weight) weight_type;
+	struct Candidate {
+		weight_type weight;
+		int lo, hi;
+		int from, index;
+		bool operator<(const Candidate &c) const {
+			if(weight < c.weight){ return true; }
+			if(c.weight < weight){ return false; }
+			return lo < c.lo || (lo == c.lo && hi < c.hi);
+		}
+	};
+	const int n = graph.size();
+	UnionFindTree uf(n);
+	std::vector<int> component(n), best(n, -1);
+	std::vector<Candidate> edges;
+	std::vector<std::pair<int, int>> result;
+	for(int u = 0; u < n; ++u){
+		for(size_t i = 0; i < graph[u].size(); ++i){
+			const auto &e = graph[u][i];
+			if(e.to == u){ continue; }
+			edges.push_back(Candidate{
+				e.weight, std::min(u, e.to), std::max(u, e.to),
+				u, static_cast<int>(i) });
+		}
+	}
+	for(int u = 0; u < n; ++u){ component[u] = u; }
+	while(!edges.empty()){
+		size_t k = 0;
+		for(size_t j = 0; j < edges.size(); ++j){
+			const Candidate e = edges[j];
+			const int cu = component[e.lo], cv = component[e.hi];
+			if(cu == cv){ continue; }
+			edges[k] = e;
+			if(best[cu] < 0 || e < edges[best[cu]]){ best[cu] = k; }
+			if(best[cv] < 0 || e < edges[best[cv]]){ best[cv] = k; }
+			++k;
+		}
+		edges.resize(k);
+		for(int c = 0; c < n; ++c){
+			if(best[c] < 0){ continue; }
+			const Candidate &e = edges[best[c]];
+			best[c] = -1;
+			if(uf.same(e.lo, e.hi)){ continue; }
+			uf.unite(e.lo, e.hi);
+			result.emplace_back(e.from, e.index);
+		}
+		for(int u = 0; u < n; ++u){ component[u] = uf.find(u); }
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
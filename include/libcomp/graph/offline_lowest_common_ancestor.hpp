@@ -0,0 +1,89 @@
+/**
+ *  @file libcomp/graph/offline_lowest_common_ancestor.hpp
+ */
+#pragma once
+#include <vector>
+#include <utility>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/structure/union_find_tree.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup offline_lowest_common_ancestor Offline lowest common ancestor
+ *  @brief    Tarjan のアルゴリズムによる最近共通祖先クエリの一括処理
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 最近共通祖先クエリの一括処理
+ *
+ *  Tarjan のオフラインアルゴリズムにより、与えられたクエリすべてに対する
+ *  最近共通祖先を求める。深さ優先探索は再帰を用いずに行い、
+ *  各頂点に関するクエリは連続した配列にまとめて保持する。
+ *    - 時間計算量: \f$ O((|V| + Q) \alpha(|V|)) \f$
+ *
+ *  @tparam    EdgeType  辺データ型
+ *  @param[in] root      木の根となる頂点の番号
+ *  @param[in] graph     グラフデータ
+ *  @param[in] queries   最近共通祖先を求める頂点の組の列
+ *  @return    各クエリに対する最近共通祖先の頂点番号の列
+ */
+template <class EdgeType>
+std::vector<int> offline_lowest_common_ancestor(
+	int root, const AdjacencyList<EdgeType> &graph,
+	const std::vector<std::pair<int, int>> &queries)
+{
+	const int n = graph.size(), q = queries.size();
+	std::vector<int> offsets(n + 1), entries(2 * q);
+	for(const auto &p : queries){
+		++offsets[p.first + 1];
+		++offsets[p.second + 1];
+	}
+	for(int i = 0; i < n; ++i){ offsets[i + 1] += offsets[i]; }
+	{
+		std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+		for(int i = 0; i < q; ++i){
+			entries[cursor[queries[i].first]++] = i;
+			entries[cursor[queries[i].second]++] = i;
+		}
+	}
+	UnionFindTree uft(n);
+	std::vector<int> ancestor(n), parent(n, -1), iteration(n, 0);
+	std::vector<int> result(q, -1), stack(1, root);
+	std::vector<char> state(n, 0); // 0: unvisited, 1: visiting, 2: finished
+	state[root] = 1;
+	ancestor[root] = root;
+	while(!stack.empty()){
+		const int u = stack.back();
+		if(iteration[u] < static_cast<int>(graph[u].size())){
+			const int v = graph[u][iteration[u]++].to;
+			if(state[v] != 0){ continue; }
+			state[v] = 1;
+			parent[v] = u;
+			ancestor[v] = v;
+			stack.push_back(v);
+			continue;
+		}
+		stack.pop_back();
+		state[u] = 2;
+		for(int i = offsets[u]; i < offsets[u + 1]; ++i){
+			const int k = entries[i];
+			const int w =
+				(queries[k].first == u ? queries[k].second : queries[k].first);
+			if(state[w] == 2){ result[k] = ancestor[uft.find(w)]; }
+		}
+		if(parent[u] >= 0){
+			const int p = parent[u];
+			ancestor[uft.unite(p, u)] = p;
+		}
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
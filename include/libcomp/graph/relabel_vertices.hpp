@@ -0,0 +1,64 @@
+/**
+ *  @file libcomp/graph/relabel_vertices.hpp
+ */
+#pragma once
+#include <vector>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup relabel_vertices Relabel vertices
+ *  @brief    頂点番号の付け替え
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 頂点番号の付け替え
+ *
+ *  頂点 v を頂点 new_id[v] に移したグラフを構築する。
+ *  各頂点の辺リストの順序は保たれる。
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *
+ *  @param[in] graph   元となるグラフデータ
+ *  @param[in] new_id  各頂点の新しい頂点番号。0 から |V|-1 の置換であること。
+ *  @return    頂点番号を付け替えたグラフ
+ */
+template <class EdgeType>
+AdjacencyList<EdgeType> relabel_vertices(
+	const AdjacencyList<EdgeType> &graph, const std::vector<int> &new_id)
+{
+	const int n = graph.size();
+	AdjacencyList<EdgeType> result(n);
+	for(int u = 0; u < n; ++u){
+		auto &list = result[new_id[u]];
+		list.reserve(graph[u].size());
+		for(const auto &e : graph[u]){
+			list.push_back(e);
+			list.back().to = new_id[e.to];
+		}
+	}
+	return result;
+}
+
+/**
+ *  @brief 置換の逆置換
+ *    - 時間計算量: \f$ O(n) \f$
+ *  @param[in] permutation  0 から n-1 の置換
+ *  @return    permutation[i] = j のとき j 番目の要素が i となる列
+ */
+inline std::vector<int> inverse_permutation(
+	const std::vector<int> &permutation)
+{
+	const int n = permutation.size();
+	std::vector<int> result(n);
+	for(int i = 0; i < n; ++i){ result[permutation[i]] = i; }
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,206 @@
+/**
+ *  @file libcomp/graph/sssp_spfa.hpp
+ */
+#pragma once
+#include <vector>
+#include <deque>
+#include <limits>
+#include <algorithm>
+#include "libcomp/graph/adjacency_list.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup sssp_spfa SSSP (SPFA)
+ *  @brief    キューを用いた Bellman-Ford 法 (SPFA) による単一始点最短路
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief  キューを用いた Bellman-Ford 法 (SPFA)
+ *
+ *  距離が更新された頂点のみをキューで管理して緩和を行う。
+ *  キューへの追加時には Small Label First ヒューリスティック
+ *  (先頭より距離が小さければ先頭に追加する) を用いる。
+ *  負閉路の検出は |V| 回の緩和ごとに親ポインタのなすグラフに閉路が
+ *  存在するかを調べることで行い、見つかった閉路をそのまま保持する。
+ *
+ *  @tparam EdgeType  辺データ型
+ */
+template <typename EdgeType>
+class ShortestPathFasterAlgorithm {
+
+public:
+	/// 距離の型
+	typedef decltype(EdgeType().weight) weight_type;
+
+private:
+	std::vector<weight_type> m_distances;
+	std::vector<int> m_parents;
+	std::vector<int> m_negative_cycle;
+
+	bool find_parent_cycle(std::vector<int> &state){
+		const int n = m_parents.size();
+		std::fill(state.begin(), state.end(), 0);
+		for(int v = 0; v < n; ++v){
+			if(state[v] != 0){ continue; }
+			int x = v;
+			while(x >= 0 && state[x] == 0){
+				state[x] = v + 1;
+				x = m_parents[x];
+			}
+			if(x < 0 || state[x] != v + 1){ continue; }
+			int y = x;
+			do {
+				m_negative_cycle.push_back(y);
+				y = m_parents[y];
+			} while(y != x);
+			std::reverse(m_negative_cycle.begin(), m_negative_cycle.end());
+			return true;
+		}
+		return false;
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	ShortestPathFasterAlgorithm()
+		: m_distances()
+		, m_parents()
+		, m_negative_cycle()
+	{ }
+
+	/**
+	 *  @brief 最短路の計算
+	 *
+	 *  sources に含まれる頂点すべてを距離 0 の始点として最短路を求める。
+	 *  負閉路に到達した時点で計算を打ち切る。
+	 *    - 時間計算量: \f$ O(|V| |E|) \f$ (実用上はより高速)
+	 *
+	 *  @param[in] graph    グラフデータ
+	 *  @param[in] sources  始点となる頂点の集合
+	 */
+	ShortestPathFasterAlgorithm(
+		const AdjacencyList<EdgeType> &graph, const std::vector<int> &sources)
+		: m_distances(graph.size(), std::numeric_limits<weight_type>::max())
+		, m_parents(graph.size(), -1)
+		, m_negative_cycle()
+	{
+		const int n = graph.size();
+		std::vector<bool> in_queue(n);
+		std::vector<int> state(n);
+		std::deque<int> q;
+		for(const int s : sources){
+			if(in_queue[s]){ continue; }
+			m_distances[s] = weight_type();
+			in_queue[s] = true;
+			q.push_back(s);
+		}
+		int relax_count = 0;
+		while(!q.empty()){
+			const int u = q.front();
+			q.pop_front();
+			in_queue[u] = false;
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				const weight_type t = m_distances[u] + e.weight;
+				if(!(t < m_distances[v])){ continue; }
+				m_distances[v] = t;
+				m_parents[v] = u;
+				if(++relax_count >= n){
+					relax_count = 0;
+					if(find_parent_cycle(state)){ return; }
+				}
+				if(in_queue[v]){ continue; }
+				in_queue[v] = true;
+				if(!q.empty() && t < m_distances[q.front()]){
+					q.push_front(v);
+				}else{
+					q.push_back(v);
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief  負閉路が見つかったかの判定
+	 *  @retval true   始点から到達可能な負閉路が存在する
+	 *  @retval false  始点から到達可能な負閉路が存在しない
+	 */
+	bool has_negative_cycle() const { return !m_negative_cycle.empty(); }
+
+	/**
+	 *  @brief  見つかった負閉路の取得
+	 *  @return 負閉路を構成する頂点の列。i 番目の頂点から i+1 番目の頂点
+	 *          (末尾の頂点からは先頭の頂点) への辺からなる。
+	 *          負閉路が存在しない場合は空のベクタ。
+	 */
+	const std::vector<int> &negative_cycle() const { return m_negative_cycle; }
+
+	/**
+	 *  @brief  最短距離テーブルの取得
+	 *  @return 各頂点への最短距離。到達不能な頂点は最大値となる。
+	 *          負閉路が存在する場合の値は意味を持たない。
+	 */
+	const std::vector<weight_type> &distances() const { return m_distances; }
+
+	/**
+	 *  @brief 最短路木における親の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v への最短路で v の直前に通る頂点。
+	 *             始点または到達不能な頂点の場合は -1。
+	 */
+	int parent(int v) const { return m_parents[v]; }
+
+};
+
+/**
+ *  @brief SPFA による単一始点最短路
+ *
+ *  負の閉路を含みうるグラフにおける単一始点最短路。
+ *    - 時間計算量: \f$ O(|V| |E|) \f$ (実用上はより高速)
+ *
+ *  @tparam    EdgeType  辺データ型
+ *  @param[in] source    始点となる頂点
+ *  @param[in] graph     グラフデータ
+ *  @return    sourceから各頂点への最短路の距離
+ *             負閉路を含む場合は空のベクタを返す
+ */
+template <typename EdgeType>
+auto sssp_spfa(int source, const AdjacencyList<EdgeType> &graph)
+	-> std::vector<decltype(EdgeType().weight)>
+{
+	typedef decltype(EdgeType().weight) weight_type;
+	const ShortestPathFasterAlgorithm<EdgeType> spfa(
+		graph, std::vector<int>(1, source));
+	if(spfa.has_negative_cycle()){ return std::vector<weight_type>(); }
+	return spfa.distances();
+}
+
+/**
+ *  @brief 負閉路の検出
+ *
+ *  グラフ中のいずれかの負閉路を求める。
+ *    - 時間計算量: \f$ O(|V| |E|) \f$ (実用上はより高速)
+ *
+ *  @tparam    EdgeType  辺データ型
+ *  @param[in] graph     グラフデータ
+ *  @return    負閉路を構成する頂点の列。i 番目の頂点から i+1 番目の頂点
+ *             (末尾の頂点からは先頭の頂点) への辺からなる。
+ *             負閉路が存在しない場合は空のベクタを返す。
+ */
+template <typename EdgeType>
+std::vector<int> find_negative_cycle(const AdjacencyList<EdgeType> &graph){
+	std::vector<int> sources(graph.size());
+	for(int i = 0; i < graph.size(); ++i){ sources[i] = i; }
+	const ShortestPathFasterAlgorithm<EdgeType> spfa(graph, sources);
+	return spfa.negative_cycle();
+}
+
+/**
+ *  @}
+ */
+
+}
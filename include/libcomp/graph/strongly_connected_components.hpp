@@ -3,8 +3,7 @@
  */
 #pragma once
 #include <vector>
-#include <stack>
-#include <utility>
+#include <algorithm>
 #include "libcomp/graph/edges.hpp"
 #include "libcomp/graph/adjacency_list.hpp"
 
@@ -17,6 +16,104 @@ namespace lc {
  *  @{
  */
 
+/**
+ *  @brief 強連結成分分解
+ *
+ *  Tarjan のアルゴリズムを再帰を用いずに実装したもの。
+ *  逆辺グラフを構築せず、一度の深さ優先探索で分解を行う。
+ *  成分番号は縮約後のグラフにおけるトポロジカル順序となる。
+ */
+class StronglyConnectedComponents {
+
+private:
+	int m_size;
+	std::vector<int> m_component;
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	StronglyConnectedComponents()
+		: m_size(0)
+		, m_component()
+	{ }
+
+	/**
+	 *  @brief 強連結成分分解
+	 *    - 時間計算量: \f$ O(|V|+|E|) \f$
+	 *  @param[in] graph  グラフデータ
+	 */
+	template <class EdgeType>
+	explicit StronglyConnectedComponents(const AdjacencyList<EdgeType> &graph)
+		: m_size(0)
+		, m_component(graph.size(), -1)
+	{
+		const int n = graph.size();
+		std::vector<int> order(n, -1), low(n), iteration(n, 0);
+		std::vector<int> stack, call_stack;
+		stack.reserve(n);
+		call_stack.reserve(n);
+		int counter = 0;
+		for(int root = 0; root < n; ++root){
+			if(order[root] >= 0){ continue; }
+			order[root] = low[root] = counter++;
+			stack.push_back(root);
+			call_stack.push_back(root);
+			while(!call_stack.empty()){
+				const int u = call_stack.back();
+				if(iteration[u] < static_cast<int>(graph[u].size())){
+					const int v = graph[u][iteration[u]++].to;
+					if(order[v] < 0){
+						order[v] = low[v] = counter++;
+						stack.push_back(v);
+						call_stack.push_back(v);
+					}else if(m_component[v] < 0){
+						low[u] = std::min(low[u], order[v]);
+					}
+					continue;
+				}
+				call_stack.pop_back();
+				if(!call_stack.empty()){
+					const int p = call_stack.back();
+					low[p] = std::min(low[p], low[u]);
+				}
+				if(low[u] != order[u]){ continue; }
+				while(true){
+					const int v = stack.back();
+					stack.pop_back();
+					m_component[v] = m_size;
+					if(v == u){ break; }
+				}
+				++m_size;
+			}
+		}
+		for(int v = 0; v < n; ++v){
+			m_component[v] = m_size - 1 - m_component[v];
+		}
+	}
+
+	/**
+	 *  @brief  強連結成分の数の取得
+	 *  @return 強連結成分の数
+	 */
+	int size() const { return m_size; }
+
+	/**
+	 *  @brief 頂点の属する強連結成分の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v の属する強連結成分の番号。
+	 *             成分 a から成分 b への辺が存在するならば a < b となる。
+	 */
+	int component_id(int v) const { return m_component[v]; }
+
+	/**
+	 *  @brief  各頂点の属する強連結成分のテーブルの取得
+	 *  @return 各頂点の属する強連結成分の番号のテーブル
+	 */
+	const std::vector<int> &components() const { return m_component; }
+
+};
+
 /**
  *  @brief 強連結成分分解
  *    - 時間計算量: \f$ O(|V|+|E|) \f$
@@ -29,49 +126,14 @@ std::vector<int> strongly_connected_components(
 	const AdjacencyList<EdgeType> &graph)
 {
 	const int n = graph.size();
-	AdjacencyList<Edge> inv_graph(n);
-	for(int u = 0; u < n; ++u){
-		for(const auto &e : graph[u]){ inv_graph.add_edge(e.to, u); }
-	}
-	std::vector<bool> used(n);
-	std::vector<int> order;
-	for(int i = 0; i < n; ++i){
-		if(used[i]){ continue; }
-		std::stack<std::pair<int, int>> stack;
-		stack.push(std::make_pair(i, 0));
-		while(!stack.empty()){
-			const int v = stack.top().first;
-			const size_t j = stack.top().second;
-			stack.pop();
-			if(j == 0){ used[v] = true; }
-			if(j == graph[v].size()){
-				order.push_back(v);
-			}else{
-				stack.push(std::make_pair(v, j + 1));
-				if(!used[graph[v][j].to]){
-					stack.push(std::make_pair(graph[v][j].to, 0));
-				}
-			}
-		}
+	const StronglyConnectedComponents scc(graph);
+	std::vector<int> representative(scc.size(), -1), result(n);
+	for(int v = 0; v < n; ++v){
+		int &r = representative[scc.component_id(v)];
+		if(r < 0){ r = v; }
+		result[v] = r;
 	}
-	std::vector<int> scc(n, -1);
-	for(int i = n - 1; i >= 0; --i){
-		if(scc[order[i]] >= 0){ continue; }
-		std::stack<std::pair<int, int>> stack;
-		stack.push(std::make_pair(order[i], 0));
-		while(!stack.empty()){
-			const int v = stack.top().first;
-			const size_t j = stack.top().second;
-			stack.pop();
-			if(j == 0){ scc[v] = order[i]; }
-			if(j == inv_graph[v].size()){ continue; }
-			stack.push(std::make_pair(v, j + 1));
-			if(scc[inv_graph[v][j].to] < 0){
-				stack.push(std::make_pair(inv_graph[v][j].to, 0));
-			}
-		}
-	}
-	return scc;
+	return result;
 }
 
 /**
@@ -79,15 +141,20 @@ std::vector<int> strongly_connected_components(
  *    - 時間計算量: \f$ O(|V|+|E|) \f$
  *  @param[in] graph  元となるグラフデータ
  *  @param[in] scc    graphに対して求められた強連結成分テーブル
+ *  @param[in] count  縮約後のグラフの頂点数。
+ *                    StronglyConnectedComponents::size() を渡すことで
+ *                    成分数と同じ大きさのグラフが得られる。
+ *                    負の場合は元のグラフの頂点数とする。
  *  @return    縮約されたグラフ
  */
 template <class EdgeType>
 AdjacencyList<EdgeType> scc_contract(
 	const AdjacencyList<EdgeType> &graph,
-	const std::vector<int> &scc)
+	const std::vector<int> &scc,
+	int count = -1)
 {
 	const int n = graph.size();
-	AdjacencyList<EdgeType> result(n);
+	AdjacencyList<EdgeType> result(count < 0 ? n : count);
 	for(int u = 0; u < n; ++u){
 		const int su = scc[u];
 		for(const auto &e : graph[u]){
@@ -106,4 +173,3 @@ AdjacencyList<EdgeType> scc_contract(
  */
 
 }
-
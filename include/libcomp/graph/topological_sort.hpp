@@ -48,6 +48,47 @@ std::vector<int> topological_sort(const AdjacencyList<EdgeType> &graph){
 	return result;
 }
 
+/**
+ *  @brief 段階ごとのトポロジカルソート
+ *
+ *  入次数が 0 の頂点を段階 0 とし、ある段階の頂点をすべて取り除いたときに
+ *  新たに入次数が 0 になった頂点を次の段階とする。
+ *  同じ段階の頂点の間には依存関係がないため、呼び出し側で並行に処理する
+ *  際の単位として使える。
+ *    - 時間計算量: \f$ O(|E| + |V|) \f$
+ *
+ *  @tparam    EdgeType  辺データ型
+ *  @param[in] graph     グラフデータ
+ *  @return    各頂点の段階 (いずれかの入次数 0 の頂点からの最長路の長さ)。
+ *             グラフが閉路を含む場合は空のベクタを返す。
+ */
+template <typename EdgeType>
+std::vector<int> topological_levels(const AdjacencyList<EdgeType> &graph){
+	const int n = graph.size();
+	std::vector<int> in_degrees(n);
+	for(int u = 0; u < n; ++u){
+		for(const auto &e : graph[u]){ ++in_degrees[e.to]; }
+	}
+	std::vector<int> order, levels(n);
+	order.reserve(n);
+	for(int u = 0; u < n; ++u){
+		if(in_degrees[u] == 0){ order.push_back(u); }
+	}
+	for(int head = 0, level = 0; head < n; ++level){
+		const int tail = order.size();
+		if(head == tail){ break; }
+		for(; head < tail; ++head){
+			const int u = order[head];
+			levels[u] = level;
+			for(const auto &e : graph[u]){
+				if(--in_degrees[e.to] == 0){ order.push_back(e.to); }
+			}
+		}
+	}
+	if(static_cast<int>(order.size()) != n){ return std::vector<int>(); }
+	return levels;
+}
+
 /**
  *  @}
  */
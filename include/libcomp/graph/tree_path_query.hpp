@@ -0,0 +1,311 @@
+/**
+ *  @file libcomp/graph/tree_path_query.hpp
+ */
+#pragma once
+#include <vector>
+#include <utility>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/structure/lazy_segment_tree.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup tree_path_query Tree path query
+ *  @brief    木上のパス・部分木に対する区間クエリ
+ *  @ingroup  graph
+ *  @{
+ */
+
+/**
+ *  @brief 木上のパス・部分木に対する区間クエリ
+ *
+ *  Heavy path がそれぞれ連続し、かつ各部分木も連続するように頂点を
+ *  一つの配列に並べ、全体を一本の LazySegmentTree で管理する。
+ *  値の結合が可換でない場合に備えて逆順に並べた木も保持し、
+ *  根に向かう向きの区間はそちらから求める。
+ *
+ *  @tparam Traits       LazySegmentTree の動作を示す型
+ *  @tparam Commutative  値の結合が可換かどうか。
+ *                       true の場合は逆順の木を保持しない。
+ */
+template <class Traits, bool Commutative = false>
+class TreePathQuery {
+
+public:
+	/// 値データ型
+	typedef typename Traits::value_type value_type;
+	/// 更新クエリ型
+	typedef typename Traits::modifier_type modifier_type;
+
+private:
+	Traits m_traits;
+	std::vector<int> m_position;
+	std::vector<int> m_head;
+	std::vector<int> m_parent;
+	std::vector<int> m_depth;
+	std::vector<int> m_subtree_size;
+	LazySegmentTree<Traits> m_forward;
+	LazySegmentTree<Traits> m_backward;
+
+	template <typename EdgeType>
+	void build_layout(const AdjacencyList<EdgeType> &graph, int root){
+		const int n = graph.size();
+		std::vector<int> heavy_child(n, -1), order;
+		order.reserve(n);
+		order.push_back(root);
+		m_parent[root] = -1;
+		m_depth[root] = 0;
+		for(int i = 0; i < static_cast<int>(order.size()); ++i){
+			const int u = order[i];
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				if(v == m_parent[u]){ continue; }
+				m_parent[v] = u;
+				m_depth[v] = m_depth[u] + 1;
+				order.push_back(v);
+			}
+		}
+		for(int i = n - 1; i >= 0; --i){
+			const int u = order[i], p = m_parent[u];
+			m_subtree_size[u] += 1;
+			if(p < 0){ continue; }
+			m_subtree_size[p] += m_subtree_size[u];
+			if(heavy_child[p] < 0 ||
+			   m_subtree_size[heavy_child[p]] < m_subtree_size[u])
+			{
+				heavy_child[p] = u;
+			}
+		}
+		std::vector<int> &stack = order;
+		stack.assign(1, root);
+		int position = 0;
+		while(!stack.empty()){
+			const int u = stack.back(), p = m_parent[u];
+			stack.pop_back();
+			m_position[u] = position++;
+			m_head[u] = (p >= 0 && heavy_child[p] == u ? m_head[p] : u);
+			for(const auto &e : graph[u]){
+				const int v = e.to;
+				if(v == p || v == heavy_child[u]){ continue; }
+				stack.push_back(v);
+			}
+			if(heavy_child[u] >= 0){ stack.push_back(heavy_child[u]); }
+		}
+	}
+
+	void build_trees(const std::vector<value_type> &values){
+		const int n = values.size();
+		std::vector<value_type> forward(n, m_traits.default_value());
+		for(int v = 0; v < n; ++v){ forward[m_position[v]] = values[v]; }
+		m_forward = LazySegmentTree<Traits>(
+			forward.begin(), forward.end(), m_traits);
+		if(!Commutative){
+			m_backward = LazySegmentTree<Traits>(
+				forward.rbegin(), forward.rend(), m_traits);
+		}
+	}
+
+	value_type forward_query(int a, int b){
+		return m_forward.query(a, b);
+	}
+
+	value_type backward_query(int a, int b){
+		if(Commutative){ return m_forward.query(a, b); }
+		const int n = m_position.size();
+		return m_backward.query(n - b, n - a);
+	}
+
+	void modify_range(int a, int b, const modifier_type &modifier){
+		m_forward.modify(a, b, modifier);
+		if(Commutative){ return; }
+		const int n = m_position.size();
+		m_backward.modify(n - b, n - a, modifier);
+	}
+
+public:
+	/**
+	 *  @brief デフォルトコンストラクタ
+	 */
+	TreePathQuery()
+		: m_traits()
+		, m_position()
+		, m_head()
+		, m_parent()
+		, m_depth()
+		, m_subtree_size()
+		, m_forward()
+		, m_backward()
+	{ }
+
+	/**
+	 *  @brief コンストラクタ (既定値で初期化)
+	 *    - 時間計算量: \f$ O(|V|) \f$
+	 *
+	 *  @param[in] graph   木のグラフデータ
+	 *  @param[in] root    根となる頂点
+	 *  @param[in] traits  処理内容を示すオブジェクト
+	 */
+	template <typename EdgeType>
+	explicit TreePathQuery(
+		const AdjacencyList<EdgeType> &graph, int root = 0,
+		const Traits &traits = Traits())
+		: m_traits(traits)
+		, m_position(graph.size())
+		, m_head(graph.size())
+		, m_parent(graph.size())
+		, m_depth(graph.size())
+		, m_subtree_size(graph.size())
+		, m_forward()
+		, m_backward()
+	{
+		build_layout(graph, root);
+		build_trees(
+			std::vector<value_type>(graph.size(), m_traits.default_value()));
+	}
+
+	/**
+	 *  @brief コンストラクタ (頂点の値による初期化)
+	 *    - 時間計算量: \f$ O(|V|) \f$
+	 *
+	 *  @param[in] graph   木のグラフデータ
+	 *  @param[in] root    根となる頂点
+	 *  @param[in] values  各頂点の初期値
+	 *  @param[in] traits  処理内容を示すオブジェクト
+	 */
+	template <typename EdgeType>
+	TreePathQuery(
+		const AdjacencyList<EdgeType> &graph, int root,
+		const std::vector<value_type> &values,
+		const Traits &traits = Traits())
+		: m_traits(traits)
+		, m_position(graph.size())
+		, m_head(graph.size())
+		, m_parent(graph.size())
+		, m_depth(graph.size())
+		, m_subtree_size(graph.size())
+		, m_forward()
+		, m_backward()
+	{
+		build_layout(graph, root);
+		build_trees(values);
+	}
+
+	/**
+	 *  @brief 配列上の位置の取得
+	 *  @param[in] v  頂点番号
+	 *  @return    頂点 v が配置された位置。
+	 *             v の部分木は [position(v), position(v) + subtree_size(v))
+	 *             に配置される。
+	 */
+	int position(int v) const { return m_position[v]; }
+
+	/**
+	 *  @brief 部分木の大きさの取得
+	 *  @param[in] v  頂点番号
+	 *  @return    v を根とする部分木に含まれる頂点数
+	 */
+	int subtree_size(int v) const { return m_subtree_size[v]; }
+
+	/**
+	 *  @brief 最小共通祖先の計算
+	 *    - 時間計算量: \f$ O(\log{|V|}) \f$
+	 *
+	 *  @param[in] u  頂点番号
+	 *  @param[in] v  頂点番号
+	 *  @return    u と v の最小共通祖先
+	 */
+	int lowest_common_ancestor(int u, int v) const {
+		while(m_head[u] != m_head[v]){
+			if(m_depth[m_head[u]] < m_depth[m_head[v]]){ std::swap(u, v); }
+			u = m_parent[m_head[u]];
+		}
+		return m_depth[u] < m_depth[v] ? u : v;
+	}
+
+	/**
+	 *  @brief パスについての問い合わせ
+	 *
+	 *  u から v に向かうパス上の頂点の値をその順に統合した結果を求める。
+	 *    - 時間計算量: \f$ O(\log^2{|V|}) \f$
+	 *
+	 *  @param[in] u  パスの始点
+	 *  @param[in] v  パスの終点
+	 *  @return    計算された結果
+	 */
+	value_type query_path(int u, int v){
+		value_type left = m_traits.default_value();
+		value_type right = m_traits.default_value();
+		while(m_head[u] != m_head[v]){
+			if(m_depth[m_head[u]] >= m_depth[m_head[v]]){
+				const int h = m_head[u];
+				left = m_traits(
+					left, backward_query(m_position[h], m_position[u] + 1));
+				u = m_parent[h];
+			}else{
+				const int h = m_head[v];
+				right = m_traits(
+					forward_query(m_position[h], m_position[v] + 1), right);
+				v = m_parent[h];
+			}
+		}
+		if(m_position[u] >= m_position[v]){
+			left = m_traits(
+				left, backward_query(m_position[v], m_position[u] + 1));
+		}else{
+			left = m_traits(
+				left, forward_query(m_position[u], m_position[v] + 1));
+		}
+		return m_traits(left, right);
+	}
+
+	/**
+	 *  @brief 部分木についての問い合わせ
+	 *
+	 *  v を根とする部分木に含まれる頂点の値を配置順に統合した結果を求める。
+	 *    - 時間計算量: \f$ O(\log{|V|}) \f$
+	 *
+	 *  @param[in] v  部分木の根
+	 *  @return    計算された結果
+	 */
+	value_type query_subtree(int v){
+		return forward_query(m_position[v], m_position[v] + m_subtree_size[v]);
+	}
+
+	/**
+	 *  @brief パス上の要素の更新
+	 *    - 時間計算量: \f$ O(\log^2{|V|}) \f$
+	 *
+	 *  @param[in] u         パスの端点
+	 *  @param[in] v         パスの端点
+	 *  @param[in] modifier  更新内容を示す値
+	 */
+	void modify_path(int u, int v, const modifier_type &modifier){
+		while(m_head[u] != m_head[v]){
+			if(m_depth[m_head[u]] < m_depth[m_head[v]]){ std::swap(u, v); }
+			const int h = m_head[u];
+			modify_range(m_position[h], m_position[u] + 1, modifier);
+			u = m_parent[h];
+		}
+		if(m_position[u] > m_position[v]){ std::swap(u, v); }
+		modify_range(m_position[u], m_position[v] + 1, modifier);
+	}
+
+	/**
+	 *  @brief 部分木の要素の更新
+	 *    - 時間計算量: \f$ O(\log{|V|}) \f$
+	 *
+	 *  @param[in] v         部分木の根
+	 *  @param[in] modifier  更新内容を示す値
+	 */
+	void modify_subtree(int v, const modifier_type &modifier){
+		modify_range(
+			m_position[v], m_position[v] + m_subtree_size[v], modifier);
+	}
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -3,12 +3,8 @@
  */
 #pragma once
 #include <vector>
-#include <stack>
-#include <limits>
-#include <algorithm>
-#include <tuple>
-#include "libcomp/structure/union_find_tree.hpp"
 #include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/lowlink.hpp"
 
 namespace lc {
 
@@ -21,8 +17,11 @@ namespace lc {
 
 /**
  *  @brief 二重辺連結成分分解
- *    - 時間計算量: \f$ O(|V| \alpha(|V|) + |E|)) \f$
- *  @param[in] graph  グラフデータ
+ *
+ *  Lowlink で求めた橋を深さ優先探索木上で切り離して成分を求める。
+ *  多重辺は Lowlink が親へ戻る辺を一本だけ読み飛ばすことで扱われる。
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *  @param[in] graph  各辺が両方向に追加された無向グラフ
  *  @return    各頂点がどの二重辺連結成分に属するかのテーブル。
  *             各二重辺連結成分の番号はその成分中のいずれかの頂点の番号となる。
  */
@@ -30,55 +29,14 @@ template <class EdgeType>
 std::vector<int> two_edge_connected_components(
 	const AdjacencyList<EdgeType> &graph)
 {
-	const int inf = std::numeric_limits<int>::max();
 	const int n = graph.size();
-	UnionFindTree uft(n);
-	for(int i = 0; i < n; ++i){
-		std::vector<int> v;
-		for(const auto &e : graph[i]){ v.push_back(e.to); }
-		std::sort(v.begin(), v.end());
-		for(int j = 1; j < static_cast<int>(v.size()); ++j){
-			if(v[j - 1] == v[j]){ uft.unite(i, v[j]); }
-		}
-	}
-	std::vector<int> depth(n, -1);
-	std::stack<std::tuple<int, int, int, int>> stack;
-	int last_returned = -1;
-	for(int i = 0; i < n; ++i){
-		if(depth[i] >= 0){ continue; }
-		stack.emplace(i, -1, 0, inf);
-		while(!stack.empty()){
-			const int u = std::get<0>(stack.top());
-			const int p = std::get<1>(stack.top());
-			const size_t j = std::get<2>(stack.top());
-			int minval = std::get<3>(stack.top());
-			stack.pop();
-			if(j == 0 && depth[u] >= 0){
-				last_returned = depth[u];
-				continue;
-			}else if(j == 0){
-				depth[u] = static_cast<int>(stack.size());
-			}else{
-				if(last_returned <= static_cast<int>(stack.size())){
-					uft.unite(u, graph[u][j - 1].to);
-				}
-				minval = std::min(minval, last_returned);
-			}
-			if(j == graph[u].size()){
-				last_returned = minval;
-			}else{
-				const int v = graph[u][j].to;
-				stack.emplace(u, p, j + 1, minval);
-				if(v != p){
-					stack.emplace(v, u, 0, inf);
-				}else{
-					last_returned = inf;
-				}
-			}
-		}
+	const Lowlink lowlink(graph);
+	std::vector<int> preorder(n), tcc(n);
+	for(int v = 0; v < n; ++v){ preorder[lowlink.order(v)] = v; }
+	for(const int v : preorder){
+		const int p = lowlink.parent(v);
+		tcc[v] = (p < 0 || lowlink.is_bridge_to(v)) ? v : tcc[p];
 	}
-	std::vector<int> tcc(n, -1);
-	for(int i = 0; i < n; ++i){ tcc[i] = uft.find(i); }
 	return tcc;
 }
 
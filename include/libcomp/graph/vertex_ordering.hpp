@@ -0,0 +1,161 @@
+/**
+ *  @file libcomp/graph/vertex_ordering.hpp
+ */
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "libcomp/graph/adjacency_list.hpp"
+#include "libcomp/graph/relabel_vertices.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup vertex_ordering Vertex ordering
+ *  @brief    メモリ局所性のための頂点の並べ替え
+ *  @ingroup  graph
+ *
+ *  各関数は頂点 v の新しい番号を new_id[v] とする置換 new_id を返す。
+ *  relabel_vertices() に渡すことで番号を付け替えたグラフが得られる。
+ *  @{
+ */
+
+/**
+ *  @brief 次数順の並べ替え
+ *
+ *  出次数の大きい頂点から順に番号を振る。次数が等しい頂点は元の番号順。
+ *    - 時間計算量: \f$ O(|V|) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    各頂点の新しい番号
+ */
+template <class EdgeType>
+std::vector<int> degree_ordering(const AdjacencyList<EdgeType> &graph){
+	const int n = graph.size();
+	int max_degree = 0;
+	for(int u = 0; u < n; ++u){
+		max_degree = std::max<int>(max_degree, graph[u].size());
+	}
+	std::vector<int> count(max_degree + 2, 0), new_id(n);
+	for(int u = 0; u < n; ++u){ ++count[max_degree - graph[u].size() + 1]; }
+	for(int d = 0; d <= max_degree; ++d){ count[d + 1] += count[d]; }
+	for(int u = 0; u < n; ++u){
+		new_id[u] = count[max_degree - graph[u].size()]++;
+	}
+	return new_id;
+}
+
+/**
+ *  @brief 幅優先探索順の並べ替え
+ *
+ *  頂点 0 から幅優先探索を行い、訪問順に番号を振る。
+ *  到達しなかった頂点があればその中で番号が最小のものから探索を続ける。
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    各頂点の新しい番号
+ */
+template <class EdgeType>
+std::vector<int> breadth_first_ordering(const AdjacencyList<EdgeType> &graph){
+	const int n = graph.size();
+	std::vector<int> new_id(n, -1), order;
+	order.reserve(n);
+	for(int s = 0; s < n; ++s){
+		if(new_id[s] >= 0){ continue; }
+		new_id[s] = order.size();
+		order.push_back(s);
+		for(size_t head = new_id[s]; head < order.size(); ++head){
+			for(const auto &e : graph[order[head]]){
+				if(new_id[e.to] >= 0){ continue; }
+				new_id[e.to] = order.size();
+				order.push_back(e.to);
+			}
+		}
+	}
+	return new_id;
+}
+
+/**
+ *  @brief 深さ優先探索順の並べ替え
+ *
+ *  頂点 0 から深さ優先探索を行い、行きがけ順に番号を振る。
+ *  到達しなかった頂点があればその中で番号が最小のものから探索を続ける。
+ *  探索は再帰を用いずに行う。
+ *    - 時間計算量: \f$ O(|V|+|E|) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    各頂点の新しい番号
+ */
+template <class EdgeType>
+std::vector<int> depth_first_ordering(const AdjacencyList<EdgeType> &graph){
+	const int n = graph.size();
+	std::vector<int> new_id(n, -1), iteration(n, 0), stack;
+	stack.reserve(n);
+	int counter = 0;
+	for(int s = 0; s < n; ++s){
+		if(new_id[s] >= 0){ continue; }
+		new_id[s] = counter++;
+		stack.push_back(s);
+		while(!stack.empty()){
+			const int u = stack.back();
+			if(iteration[u] == static_cast<int>(graph[u].size())){
+				stack.pop_back();
+				continue;
+			}
+			const int v = graph[u][iteration[u]++].to;
+			if(new_id[v] >= 0){ continue; }
+			new_id[v] = counter++;
+			stack.push_back(v);
+		}
+	}
+	return new_id;
+}
+
+/**
+ *  @brief Reverse Cuthill-McKee 法による並べ替え
+ *
+ *  連結成分ごとに次数最小の未訪問頂点から幅優先探索を行い、
+ *  各頂点の未訪問の隣接頂点を次数の昇順に訪問する。
+ *  得られた順序を逆にしたものを新しい番号とする。
+ *  隣接行列の帯幅が小さくなり、近い頂点同士が近い番号を持つ。
+ *  無向グラフ (各辺が両方向に追加されたもの) を想定している。
+ *    - 時間計算量: \f$ O(|V| + |E| \log{\Delta}) \f$
+ *
+ *  @param[in] graph  グラフデータ
+ *  @return    各頂点の新しい番号
+ */
+template <class EdgeType>
+std::vector<int> reverse_cuthill_mckee_ordering(
+	const AdjacencyList<EdgeType> &graph)
+{
+	const int n = graph.size();
+	const std::vector<int> by_degree = inverse_permutation(
+		degree_ordering(graph));
+	std::vector<int> new_id(n, -1), order;
+	order.reserve(n);
+	auto degree_less = [&](int a, int b){
+		return graph[a].size() < graph[b].size();
+	};
+	for(int i = n - 1; i >= 0; --i){
+		const int s = by_degree[i];
+		if(new_id[s] >= 0){ continue; }
+		new_id[s] = order.size();
+		order.push_back(s);
+		for(size_t head = new_id[s]; head < order.size(); ++head){
+			const size_t first = order.size();
+			for(const auto &e : graph[order[head]]){
+				if(new_id[e.to] >= 0){ continue; }
+				new_id[e.to] = order.size();
+				order.push_back(e.to);
+			}
+			std::stable_sort(order.begin() + first, order.end(), degree_less);
+		}
+	}
+	for(int i = 0; i < n; ++i){ new_id[order[i]] = n - 1 - i; }
+	return new_id;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -16,6 +16,222 @@ namespace lc {
  *  @{
  */
 
+/**
+ *  @brief 高速フーリエ変換
+ *
+ *  回転因子を長さごとに保持し、必要になった長さまで追加で計算する。
+ *  順変換は周波数間引き、逆変換は時間間引きで in-place に行い、
+ *  順変換の出力と逆変換の入力はビット反転順となる。
+ *  複素数の乗算は std::complex の演算子を用いずに実部と虚部で直接計算する。
+ *  順変換は \f$ F(k) = \sum_{j} f(j) e^{2 \pi i jk / n} \f$ を求める。
+ *
+ *  @tparam T  実数型
+ */
+template <typename T>
+class FastFourierTransform {
+
+public:
+	/// 複素数型
+	typedef std::complex<T> complex_type;
+
+private:
+	// m_real[h + j] + i m_imag[h + j] = exp(i pi j / h)
+	std::vector<T> m_real;
+	std::vector<T> m_imag;
+
+	static T *raw(complex_type *a){ return reinterpret_cast<T *>(a); }
+	static const T *raw(const complex_type *a){
+		return reinterpret_cast<const T *>(a);
+	}
+
+public:
+	/**
+	 *  @brief コンストラクタ
+	 *  @param[in] n  回転因子を用意しておく変換の長さ
+	 */
+	explicit FastFourierTransform(int n = 1)
+		: m_real(1)
+		, m_imag(1)
+	{
+		reserve(n);
+	}
+
+	/**
+	 *  @brief  共有インスタンスの取得
+	 *  @return 同じ実数型を用いる関数の間で回転因子を共有するためのインスタンス
+	 */
+	static FastFourierTransform &shared(){
+		static FastFourierTransform instance;
+		return instance;
+	}
+
+	/**
+	 *  @brief 回転因子の計算
+	 *
+	 *  長さ n 以下の変換に用いる回転因子を計算する。
+	 *  計算済みの部分は再計算しない。
+	 *
+	 *  @param[in] n  変換の長さ (2冪であること)
+	 */
+	void reserve(int n){
+		if(static_cast<int>(m_real.size()) >= n){ return; }
+		const T pi = std::atan(T(1)) * 4;
+		m_real.reserve(n);
+		m_imag.reserve(n);
+		while(static_cast<int>(m_real.size()) < n){
+			const int h = m_real.size();
+			for(int j = 0; j < h; ++j){
+				m_real.push_back(std::cos(pi * j / h));
+				m_imag.push_back(std::sin(pi * j / h));
+			}
+		}
+	}
+
+	/**
+	 *  @brief ビット反転順への並べ替え
+	 *    - 時間計算量: \f$ O(n) \f$
+	 *  @param[in,out] a  並べ替えるデータ
+	 *  @param[in]     n  データの長さ (2冪であること)
+	 */
+	static void bit_reverse(complex_type *a, int n){
+		for(int i = 0, j = 1; j < n - 1; ++j){
+			for(int k = n >> 1; k > (i ^= k); k >>= 1);
+			if(j < i){ std::swap(a[i], a[j]); }
+		}
+	}
+
+	/**
+	 *  @brief 順変換 (周波数間引き)
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *  @param[in,out] a  変換するデータ。変換後はビット反転順に並ぶ。
+	 *  @param[in]     n  変換の長さ (2冪かつ reserve 済みであること)
+	 */
+	void transform(complex_type *a, int n) const {
+		T *p = raw(a);
+		for(int h = n >> 1; h >= 1; h >>= 1){
+			const T *wr = m_real.data() + h, *wi = m_imag.data() + h;
+			for(int s = 0; s < n; s += 2 * h){
+				T *x = p + 2 * s, *y = p + 2 * (s + h);
+				for(int j = 0; j < h; ++j){
+					const T xr = x[2 * j], xi = x[2 * j + 1];
+					const T yr = y[2 * j], yi = y[2 * j + 1];
+					const T dr = xr - yr, di = xi - yi;
+					x[2 * j] = xr + yr;
+					x[2 * j + 1] = xi + yi;
+					y[2 * j] = dr * wr[j] - di * wi[j];
+					y[2 * j + 1] = dr * wi[j] + di * wr[j];
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief 逆変換 (時間間引き)
+	 *
+	 *  長さ n による除算は行わない。
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *
+	 *  @param[in,out] a  ビット反転順に並んだ変換するデータ
+	 *  @param[in]     n  変換の長さ (2冪かつ reserve 済みであること)
+	 */
+	void inverse_transform(complex_type *a, int n) const {
+		T *p = raw(a);
+		for(int h = 1; h < n; h <<= 1){
+			const T *wr = m_real.data() + h, *wi = m_imag.data() + h;
+			for(int s = 0; s < n; s += 2 * h){
+				T *x = p + 2 * s, *y = p + 2 * (s + h);
+				for(int j = 0; j < h; ++j){
+					const T yr = y[2 * j], yi = y[2 * j + 1];
+					const T tr = yr * wr[j] + yi * wi[j];
+					const T ti = yi * wr[j] - yr * wi[j];
+					const T xr = x[2 * j], xi = x[2 * j + 1];
+					x[2 * j] = xr + tr;
+					x[2 * j + 1] = xi + ti;
+					y[2 * j] = xr - tr;
+					y[2 * j + 1] = xi - ti;
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief 実数列の順変換
+	 *
+	 *  長さ n の実数列を長さ n/2 の複素数列とみなして変換し、
+	 *  その結果から元の列の変換の前半を復元する。
+	 *  残りの要素は \f$ F(n-k) = \overline{F(k)} \f$ で得られる。
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *
+	 *  @param[in]  x    変換する実数列
+	 *  @param[out] out  変換結果 F(0), ..., F(n/2) を格納する長さ n/2+1 の領域
+	 *  @param[in]  n    変換の長さ (2以上の2冪かつ reserve 済みであること)
+	 */
+	void real_transform(const T *x, complex_type *out, int n) const {
+		const int m = n >> 1;
+		T *z = raw(out);
+		for(int i = 0; i < n; ++i){ z[i] = x[i]; }
+		transform(out, m);
+		bit_reverse(out, m);
+		const T *wr = m_real.data() + m, *wi = m_imag.data() + m;
+		const T zr0 = z[0], zi0 = z[1];
+		z[0] = zr0 + zi0;
+		z[1] = 0;
+		z[2 * m] = zr0 - zi0;
+		z[2 * m + 1] = 0;
+		for(int k = 1, l = m - 1; k <= l; ++k, --l){
+			const T ar = z[2 * k], ai = z[2 * k + 1];
+			const T br = z[2 * l], bi = z[2 * l + 1];
+			// E = (Z(k) + conj(Z(m-k))) / 2, O = (Z(k) - conj(Z(m-k))) / 2i
+			const T er = (ar + br) / 2, ei = (ai - bi) / 2;
+			const T or_ = (ai + bi) / 2, oi = (br - ar) / 2;
+			const T tr = or_ * wr[k] - oi * wi[k];
+			const T ti = or_ * wi[k] + oi * wr[k];
+			// F(m-k) = conj(E) - conj(w^k O)
+			z[2 * k] = er + tr;
+			z[2 * k + 1] = ei + ti;
+			z[2 * l] = er - tr;
+			z[2 * l + 1] = ti - ei;
+		}
+	}
+
+	/**
+	 *  @brief 実数列の逆変換
+	 *
+	 *  real_transform の逆の操作を行う。長さ n による除算は行わない。
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *
+	 *  @param[in,out] in  変換結果 F(0), ..., F(n/2)。作業領域として書き換えられる。
+	 *  @param[out]    x   逆変換した実数列を n 倍したものを格納する領域
+	 *  @param[in]     n   変換の長さ (2以上の2冪かつ reserve 済みであること)
+	 */
+	void inverse_real_transform(complex_type *in, T *x, int n) const {
+		const int m = n >> 1;
+		T *z = raw(in);
+		const T *wr = m_real.data() + m, *wi = m_imag.data() + m;
+		const T f0 = z[0], fm = z[2 * m];
+		z[0] = f0 + fm;
+		z[1] = f0 - fm;
+		for(int k = 1, l = m - 1; k <= l; ++k, --l){
+			const T ar = z[2 * k], ai = z[2 * k + 1];
+			const T br = z[2 * l], bi = z[2 * l + 1];
+			// E = F(k) + conj(F(m-k)), O = (F(k) - conj(F(m-k))) conj(w^k)
+			const T er = ar + br, ei = ai - bi;
+			const T dr = ar - br, di = ai + bi;
+			const T or_ = dr * wr[k] + di * wi[k];
+			const T oi = di * wr[k] - dr * wi[k];
+			// Z(k) = E + iO, Z(m-k) = conj(E) + i conj(O)
+			z[2 * k] = er - oi;
+			z[2 * k + 1] = ei + or_;
+			z[2 * l] = er + oi;
+			z[2 * l + 1] = or_ - ei;
+		}
+		bit_reverse(in, m);
+		inverse_transform(in, m);
+		for(int i = 0; i < n; ++i){ x[i] = z[i]; }
+	}
+
+};
+
 /**
  *  @brief 高速フーリエ変換
  *    - 時間計算量: \f$ O(n \log{n}) \f$
@@ -28,45 +244,70 @@ template <typename T>
 std::vector<std::complex<T>> fast_fourier_transform(
 	const std::vector<std::complex<T>> &f, bool inverse)
 {
-	const int n = f.size(), mask = n - 1;
+	const int n = f.size();
 	assert((n & (n - 1)) == 0);
-	const T pi = atan(1.0) * 4.0;
-	std::vector<T> sin_table(n);
-	const int cos_offset = (inverse ? 3 : 1) * (n >> 2);
-	for(int i = 0; i < n; ++i){
-		const int k = (inverse ? ((n - i) & mask) : i);
-		sin_table[k] = sin((2.0 * pi / n) * i);
-	}
+	auto &fft = FastFourierTransform<T>::shared();
+	fft.reserve(n);
 	std::vector<std::complex<T>> result(f);
-	for(int i = 0, j = 1; i < n - 1; ++j){
-		for(int k = n >> 1; k > (i ^= k); k >>= 1);
-		if(j < i){ swap(result[i], result[j]); }
-	}
-	for(int mh = 1; mh + mh <= n; mh += mh){
-		const int m = (mh << 1);
-		int irev = 0;
-		for(int i = 0; i < n; i += m){
-			const std::complex<T> w(
-				sin_table[(irev + cos_offset) & mask], sin_table[irev]);
-			for(int k = n >> 2; k > (irev ^= k); k >>= 1);
-			for(int j = i; j < mh + i; ++j){
-				const int k = j + mh;
-				const std::complex<T> x = result[j] - result[k];
-				result[j] += result[k];
-				result[k] = w * x;
-			}
-		}
-	}
 	if(inverse){
-		const T r = 1.0 / n;
+		fft.bit_reverse(result.data(), n);
+		fft.inverse_transform(result.data(), n);
+		const T r = T(1) / n;
 		for(int i = 0; i < n; ++i){ result[i] *= r; }
+	}else{
+		fft.transform(result.data(), n);
+		fft.bit_reverse(result.data(), n);
 	}
 	return result;
 }
 
 /**
- *  @}
+ *  @brief 実数列の高速フーリエ変換
+ *
+ *  長さ n/2 の複素数列の変換を用いて計算する。
+ *    - 時間計算量: \f$ O(n \log{n}) \f$
+ *
+ *  @param[in] f  入力データ (要素数が2以上の2冪であること)
+ *  @return    f を離散フーリエ変換した結果のうち F(0), ..., F(n/2)
  */
+template <typename T>
+std::vector<std::complex<T>> real_fast_fourier_transform(
+	const std::vector<T> &f)
+{
+	const int n = f.size();
+	assert(n >= 2 && (n & (n - 1)) == 0);
+	auto &fft = FastFourierTransform<T>::shared();
+	fft.reserve(n);
+	std::vector<std::complex<T>> result(n / 2 + 1);
+	fft.real_transform(f.data(), result.data(), n);
+	return result;
+}
 
+/**
+ *  @brief 実数列の高速フーリエ逆変換
+ *    - 時間計算量: \f$ O(n \log{n}) \f$
+ *
+ *  @param[in] f  実数列の離散フーリエ変換の結果のうち F(0), ..., F(n/2)
+ *  @param[in] n  元の実数列の長さ (2以上の2冪であること)
+ *  @return    f を逆変換した実数列
+ */
+template <typename T>
+std::vector<T> inverse_real_fast_fourier_transform(
+	std::vector<std::complex<T>> f, int n)
+{
+	assert(n >= 2 && (n & (n - 1)) == 0);
+	assert(static_cast<int>(f.size()) == n / 2 + 1);
+	auto &fft = FastFourierTransform<T>::shared();
+	fft.reserve(n);
+	std::vector<T> result(n);
+	fft.inverse_real_transform(f.data(), result.data(), n);
+	const T r = T(1) / n;
+	for(int i = 0; i < n; ++i){ result[i] *= r; }
+	return result;
 }
 
+/**
+ *  @}
+ */
+
+}
@@ -2,6 +2,9 @@
  *  @file math/fft_convolution.hpp
  */
 #pragma once
+#include <vector>
+#include <complex>
+#include <algorithm>
 #include "libcomp/math/fast_fourier_transform.hpp"
 
 namespace lc {
@@ -40,6 +43,71 @@ std::vector<std::complex<double>> fft_convolution(
 	return complex_f;
 }
 
+/**
+ *  @brief 実数列の畳み込み乗算
+ *
+ *  f と g の長さは異なっていてもよく、巡回しない畳み込みを求める。
+ *  f を実部、g を虚部に詰めた長さ \f$ 2^k \geq n+m-1 \f$ の複素数列を
+ *  一度だけ順変換し、両者の変換を対称性から取り出して積をとる。
+ *  積の逆変換は実数列の逆変換を用いて長さの半分の変換で行う。
+ *  fft_convolution と比べて変換の量は半分となる。
+ *  nm が変換の計算量より十分小さい場合は直接計算する。
+ *  変換の誤差は fft_convolution と同程度であり、
+ *  整数を入力とする場合、結果の絶対値が目安として \f$ 10^{14} \f$ 程度までなら
+ *  丸めによって正しい値が得られる。
+ *    - 時間計算量: \f$ O((n+m) \log{(n+m)}) \f$
+ *
+ *  \f$ (f * g)(k) = \sum_{i+j=k} {f(i) g(j)} \f$
+ *
+ *  @param[in] f  入力データ1 (長さ n)
+ *  @param[in] g  入力データ2 (長さ m)
+ *  @return    fとgを畳み込んだ結果 (長さ n+m-1)
+ */
+template <typename T>
+std::vector<double> fft_real_convolution(
+	const std::vector<T> &f, const std::vector<T> &g)
+{
+	typedef std::complex<double> complex_type;
+	const int n = f.size(), m = g.size();
+	if(n == 0 || m == 0){ return std::vector<double>(); }
+	const int k = n + m - 1;
+	int len = 2, bits = 1;
+	while(len < k){ len <<= 1; ++bits; }
+	// 直接計算の積和1回と変換の len log(len) あたりの計算時間の比は約 1:4
+	if(static_cast<long long>(n) * m <= 4ll * len * bits){
+		std::vector<double> result(k);
+		for(int i = 0; i < n; ++i){
+			const double x = f[i];
+			for(int j = 0; j < m; ++j){ result[i + j] += x * g[j]; }
+		}
+		return result;
+	}
+	auto &fft = FastFourierTransform<double>::shared();
+	fft.reserve(len);
+	std::vector<complex_type> z(len);
+	for(int i = 0; i < n; ++i){ z[i].real(f[i]); }
+	for(int i = 0; i < m; ++i){ z[i].imag(g[i]); }
+	fft.transform(z.data(), len);
+	fft.bit_reverse(z.data(), len);
+	// F(j) G(j) = (Z(j)^2 - conj(Z(-j))^2) / 4i
+	const int half = len >> 1;
+	std::vector<complex_type> p(half + 1);
+	for(int j = 0; j <= half; ++j){
+		const complex_type a = z[j], b = z[(len - j) & (len - 1)];
+		const double ar = a.real(), ai = a.imag();
+		const double br = b.real(), bi = b.imag();
+		const double dr = (ar * ar - ai * ai) - (br * br - bi * bi);
+		const double di = 2 * ar * ai + 2 * br * bi;
+		p[j] = complex_type(di * 0.25, -dr * 0.25);
+	}
+	std::vector<double> result(len);
+	fft.inverse_real_transform(p.data(), result.data(), len);
+	result.resize(k);
+	const double r = 1.0 / len;
+	for(int i = 0; i < k; ++i){ result[i] *= r; }
+	return result;
+}
+
 /**
  *  @}
  */
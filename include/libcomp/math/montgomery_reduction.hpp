@@ -0,0 +1,105 @@
+/**
+ *  @file libcomp/math/montgomery_reduction.hpp
+ */
+#pragma once
+#include <cstdint>
+
+namespace lc {
+
+/**
+ *  @defgroup montgomery_reduction Montgomery reduction
+ *  @brief    Montgomery 乗算による剰余演算
+ *  @ingroup  math
+ *  @{
+ */
+
+/**
+ *  @brief Montgomery 乗算による剰余演算
+ *
+ *  \f$ R = 2^{32} \f$ として、値 x を \f$ xR \bmod \mathit{MOD} \f$ の形
+ *  (Montgomery 表現) で扱い、乗算の後の剰余を除算なしで計算する。
+ *  各演算の結果は正規化されず \f$ [0, 2\mathit{MOD}) \f$ の範囲となる。
+ *  引数も同じ範囲の値を受け付ける。
+ *
+ *  @tparam MOD  法とする値。\f$ 2^{30} \f$ 未満の奇数であること。
+ */
+template <int MOD>
+class MontgomeryReduction {
+
+	static_assert(
+		MOD > 1 && MOD % 2 == 1 && MOD < (1 << 30),
+		"MOD must be an odd number less than 2^30");
+
+private:
+	static constexpr uint32_t newton(uint32_t x, int k){
+		return k == 0 ? x : newton(x * (2u - MOD * x), k - 1);
+	}
+
+public:
+	/**
+	 *  @brief  Montgomery 乗算に用いる定数の取得
+	 *  @return \f$ -\mathit{MOD}^{-1} \bmod 2^{32} \f$
+	 */
+	static constexpr uint32_t negative_inverse(){
+		return 0u - newton(MOD, 5);
+	}
+
+	/**
+	 *  @brief  Montgomery 表現への変換に用いる定数の取得
+	 *  @return \f$ R^2 \bmod \mathit{MOD} \f$
+	 */
+	static constexpr uint32_t r2(){
+		return (0ull - static_cast<uint64_t>(MOD)) % MOD;
+	}
+
+	/**
+	 *  @brief Montgomery リダクション
+	 *  @param[in] t  \f$ \mathit{MOD} \cdot R \f$ 未満の値
+	 *  @return    \f$ tR^{-1} \bmod \mathit{MOD} \f$ と合同な
+	 *             \f$ [0, 2\mathit{MOD}) \f$ の値
+	 */
+	static uint32_t reduce(uint64_t t){
+		const uint32_t m = static_cast<uint32_t>(t) * negative_inverse();
+		return (t + static_cast<uint64_t>(m) * MOD) >> 32;
+	}
+
+	/**
+	 *  @brief Montgomery 表現同士の乗算
+	 *  @param[in] a  Montgomery 表現の値
+	 *  @param[in] b  Montgomery 表現の値
+	 *  @return    積の Montgomery 表現
+	 */
+	static uint32_t multiply(uint32_t a, uint32_t b){
+		return reduce(static_cast<uint64_t>(a) * b);
+	}
+
+	/**
+	 *  @brief Montgomery 表現への変換
+	 *  @param[in] x  \f$ [0, 2\mathit{MOD}) \f$ の値
+	 *  @return    x の Montgomery 表現
+	 */
+	static uint32_t transform(uint32_t x){ return multiply(x, r2()); }
+
+	/**
+	 *  @brief Montgomery 表現からの変換
+	 *  @param[in] x  Montgomery 表現の値
+	 *  @return    x が表す \f$ [0, \mathit{MOD}) \f$ の値
+	 */
+	static uint32_t restore(uint32_t x){ return normalize(reduce(x)); }
+
+	/**
+	 *  @brief 正規化
+	 *  @param[in] x  \f$ [0, 2\mathit{MOD}) \f$ の値
+	 *  @return    x と合同な \f$ [0, \mathit{MOD}) \f$ の値
+	 */
+	static uint32_t normalize(uint32_t x){
+		return x >= static_cast<uint32_t>(MOD) ? x - MOD : x;
+	}
+
+};
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,125 @@
+/**
+ *  @file libcomp/math/ntt_convolution.hpp
+ */
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "libcomp/math/modulus_integer.hpp"
+#include "libcomp/math/modulus_utility.hpp"
+#include "libcomp/math/number_theoretic_transform.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup ntt_convolution Convolution (NTT-based)
+ *  @brief    数論変換を用いた畳み込み乗算
+ *  @ingroup  math
+ *  @{
+ */
+
+/**
+ *  @brief 数論変換を用いた畳み込み乗算
+ *
+ *  f と g の長さは異なっていてもよく、巡回しない畳み込みを求める。
+ *  短い方の長さが小さい場合は直接計算する。
+ *    - 時間計算量: \f$ O((n+m) \log{(n+m)}) \f$
+ *
+ *  \f$ (f * g)(k) = \sum_{i+j=k} {f(i) g(j)} \f$
+ *
+ *  @tparam    MOD  法とする素数。MOD-1 が n+m-1 以上の2冪で割り切れること。
+ *  @param[in] f    入力データ1 (長さ n)
+ *  @param[in] g    入力データ2 (長さ m)
+ *  @return    f と g を畳み込んだ結果 (長さ n+m-1)
+ */
+template <int MOD>
+std::vector<ModulusInteger<MOD>> ntt_convolution(
+	const std::vector<ModulusInteger<MOD>> &f,
+	const std::vector<ModulusInteger<MOD>> &g)
+{
+	typedef ModulusInteger<MOD> value_type;
+	const int n = f.size(), m = g.size();
+	if(n == 0 || m == 0){ return std::vector<value_type>(); }
+	if(std::min(n, m) <= 32){
+		std::vector<value_type> result(n + m - 1);
+		for(int i = 0; i < n; ++i){
+			for(int j = 0; j < m; ++j){ result[i + j] += f[i] * g[j]; }
+		}
+		return result;
+	}
+	std::vector<uint32_t> a(n), b(m);
+	for(int i = 0; i < n; ++i){ a[i] = *f[i]; }
+	for(int i = 0; i < m; ++i){ b[i] = *g[i]; }
+	const auto c = NumberTheoreticTransform<MOD>::shared().convolution(
+		std::move(a), std::move(b));
+	std::vector<value_type> result(n + m - 1);
+	for(int i = 0; i < n + m - 1; ++i){ result[i] = value_type(c[i]); }
+	return result;
+}
+
+/**
+ *  @brief 任意の法での畳み込み乗算
+ *
+ *  3つの素数 167772161, 469762049, 998244353 を法とする畳み込みを
+ *  数論変換で求め、中国剰余定理 (Garner のアルゴリズム) で復元する。
+ *  結果の各要素の真の値が3つの素数の積 (約 \f$ 7.9 \times 10^{25} \f$)
+ *  未満であれば正しく求まるため、MOD が \f$ 2^{30} \f$ 程度のとき
+ *  n+m-1 は \f$ 2^{23} \f$ まで扱える。
+ *    - 時間計算量: \f$ O((n+m) \log{(n+m)}) \f$
+ *
+ *  @tparam    MOD  法とする値 (素数である必要はない)
+ *  @param[in] f    入力データ1 (長さ n)
+ *  @param[in] g    入力データ2 (長さ m)
+ *  @return    f と g を畳み込んだ結果 (長さ n+m-1)
+ */
+template <int MOD>
+std::vector<ModulusInteger<MOD>> arbitrary_modulus_convolution(
+	const std::vector<ModulusInteger<MOD>> &f,
+	const std::vector<ModulusInteger<MOD>> &g)
+{
+	typedef ModulusInteger<MOD> value_type;
+	static const int M1 = 167772161, M2 = 469762049, M3 = 998244353;
+	const int n = f.size(), m = g.size();
+	if(n == 0 || m == 0){ return std::vector<value_type>(); }
+	if(std::min(n, m) <= 32){
+		std::vector<value_type> result(n + m - 1);
+		for(int i = 0; i < n; ++i){
+			for(int j = 0; j < m; ++j){ result[i + j] += f[i] * g[j]; }
+		}
+		return result;
+	}
+	const auto reduce = [](const std::vector<value_type> &x, int p){
+		std::vector<uint32_t> y(x.size());
+		for(size_t i = 0; i < x.size(); ++i){ y[i] = *x[i] % p; }
+		return y;
+	};
+	const auto c1 = NumberTheoreticTransform<M1>::shared().convolution(
+		reduce(f, M1), reduce(g, M1));
+	const auto c2 = NumberTheoreticTransform<M2>::shared().convolution(
+		reduce(f, M2), reduce(g, M2));
+	const auto c3 = NumberTheoreticTransform<M3>::shared().convolution(
+		reduce(f, M3), reduce(g, M3));
+	const uint64_t inv_m1_mod_m2 = modulus_inverse<M2>(M1);
+	const uint64_t inv_m1m2_mod_m3 =
+		modulus_inverse<M3>(static_cast<long long>(M1) * M2 % M3);
+	const value_type m1(M1 % MOD), m1m2 = m1 * value_type(M2 % MOD);
+	std::vector<value_type> result(n + m - 1);
+	for(int i = 0; i < n + m - 1; ++i){
+		const uint64_t x1 = c1[i];
+		const uint64_t x2 = (c2[i] + M2 - x1 % M2) * inv_m1_mod_m2 % M2;
+		const uint64_t y = (x1 + x2 * M1) % M3;
+		const uint64_t x3 = (c3[i] + M3 - y) * inv_m1m2_mod_m3 % M3;
+		result[i] =
+			value_type(static_cast<int>(x1 % MOD)) +
+			m1 * value_type(static_cast<int>(x2)) +
+			m1m2 * value_type(static_cast<int>(x3));
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
@@ -0,0 +1,266 @@
+/**
+ *  @file libcomp/math/number_theoretic_transform.hpp
+ */
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include "libcomp/math/modulus_integer.hpp"
+#include "libcomp/math/montgomery_reduction.hpp"
+
+namespace lc {
+
+/**
+ *  @defgroup number_theoretic_transform Number theoretic transform
+ *  @brief    数論変換
+ *  @ingroup  math
+ *  @{
+ */
+
+/**
+ *  @brief 数論変換
+ *
+ *  素数 MOD を法とする数論変換を行う。回転因子は変換する長さごとに
+ *  Montgomery 表現で保持し、必要になった長さまで追加で計算する。
+ *  回転因子のみを Montgomery 表現とすることで、変換対象の値は
+ *  通常の表現のまま扱える。
+ *  順変換は周波数間引き、逆変換は時間間引きで行い、
+ *  順変換の出力と逆変換の入力はビット反転順となる。
+ *  畳み込みではビット反転の並べ替えが不要となる。
+ *
+ *  @tparam MOD  法とする素数。\f$ 2^{30} \f$ 未満であること。
+ *               変換できる長さは MOD-1 を割り切る2冪に限られる。
+ */
+template <int MOD>
+class NumberTheoreticTransform {
+
+private:
+	typedef MontgomeryReduction<MOD> reduction_type;
+
+	std::vector<uint32_t> m_roots;
+	std::vector<uint32_t> m_inverse_roots;
+
+	static uint32_t power(uint64_t x, uint64_t y){
+		uint64_t z = 1;
+		for(x %= MOD; y > 0; y >>= 1){
+			if(y & 1){ z = z * x % MOD; }
+			x = x * x % MOD;
+		}
+		return static_cast<uint32_t>(z);
+	}
+
+	static uint32_t primitive_root(){
+		std::vector<int> factors;
+		int r = MOD - 1;
+		for(int p = 2; p * p <= r; ++p){
+			if(r % p != 0){ continue; }
+			factors.push_back(p);
+			while(r % p == 0){ r /= p; }
+		}
+		if(r > 1){ factors.push_back(r); }
+		for(uint32_t g = 2; ; ++g){
+			bool accept = true;
+			for(const int p : factors){
+				if(power(g, (MOD - 1) / p) == 1){ accept = false; }
+			}
+			if(accept){ return g; }
+		}
+	}
+
+	static uint32_t add(uint32_t x, uint32_t y){
+		const uint32_t z = x + y;
+		return z >= 2u * MOD ? z - 2u * MOD : z;
+	}
+	static uint32_t subtract(uint32_t x, uint32_t y){
+		const uint32_t z = x + 2u * MOD - y;
+		return z >= 2u * MOD ? z - 2u * MOD : z;
+	}
+
+public:
+	/**
+	 *  @brief コンストラクタ
+	 *  @param[in] n  回転因子を用意しておく変換の長さ
+	 */
+	explicit NumberTheoreticTransform(int n = 1)
+		: m_roots(1)
+		, m_inverse_roots(1)
+	{
+		reserve(n);
+	}
+
+	/**
+	 *  @brief  共有インスタンスの取得
+	 *  @return 同じ MOD を用いる関数の間で回転因子を共有するためのインスタンス
+	 */
+	static NumberTheoreticTransform &shared(){
+		static NumberTheoreticTransform instance;
+		return instance;
+	}
+
+	/**
+	 *  @brief  変換できる最大の長さの取得
+	 *  @return MOD-1 を割り切る最大の2冪
+	 */
+	static int max_size(){ return (MOD - 1) & -(MOD - 1); }
+
+	/**
+	 *  @brief 回転因子の計算
+	 *
+	 *  長さ n 以下の変換に用いる回転因子を計算する。
+	 *  計算済みの部分は再計算しない。
+	 *
+	 *  @param[in] n  変換の長さ (2冪であること)
+	 */
+	void reserve(int n){
+		assert(n <= max_size());
+		if(static_cast<int>(m_roots.size()) >= n){ return; }
+		const uint32_t g = primitive_root();
+		m_roots.reserve(n);
+		m_inverse_roots.reserve(n);
+		while(static_cast<int>(m_roots.size()) < n){
+			const int h = m_roots.size();
+			const uint32_t w = power(g, (MOD - 1) / (2 * h));
+			const uint32_t v = power(w, MOD - 2);
+			const uint32_t wm = reduction_type::transform(w);
+			const uint32_t vm = reduction_type::transform(v);
+			uint32_t x = reduction_type::transform(1), y = x;
+			for(int j = 0; j < h; ++j){
+				m_roots.push_back(x);
+				m_inverse_roots.push_back(y);
+				x = reduction_type::multiply(x, wm);
+				y = reduction_type::multiply(y, vm);
+			}
+		}
+	}
+
+	/**
+	 *  @brief 順変換 (周波数間引き)
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *  @param[in,out] a  変換するデータ。値は \f$ [0, 2\mathit{MOD}) \f$ であること。
+	 *                    変換後の値も同じ範囲となり、ビット反転順に並ぶ。
+	 *  @param[in]     n  変換の長さ (2冪かつ reserve 済みであること)
+	 */
+	void transform(uint32_t *a, int n) const {
+		for(int h = n >> 1; h >= 1; h >>= 1){
+			const uint32_t *w = m_roots.data() + h;
+			for(int s = 0; s < n; s += 2 * h){
+				uint32_t *x = a + s, *y = a + s + h;
+				for(int j = 0; j < h; ++j){
+					const uint32_t p = x[j], q = y[j];
+					x[j] = add(p, q);
+					y[j] = reduction_type::multiply(subtract(p, q), w[j]);
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief 逆変換 (時間間引き)
+	 *
+	 *  長さ n による除算は行わない。
+	 *    - 時間計算量: \f$ O(n \log{n}) \f$
+	 *
+	 *  @param[in,out] a  ビット反転順に並んだ変換するデータ。
+	 *                    値は \f$ [0, 2\mathit{MOD}) \f$ であること。
+	 *                    変換後の値も同じ範囲となる。
+	 *  @param[in]     n  変換の長さ (2冪かつ reserve 済みであること)
+	 */
+	void inverse_transform(uint32_t *a, int n) const {
+		for(int h = 1; h < n; h <<= 1){
+			const uint32_t *w = m_inverse_roots.data() + h;
+			for(int s = 0; s < n; s += 2 * h){
+				uint32_t *x = a + s, *y = a + s + h;
+				for(int j = 0; j < h; ++j){
+					const uint32_t p = x[j];
+					const uint32_t q = reduction_type::multiply(y[j], w[j]);
+					x[j] = add(p, q);
+					y[j] = subtract(p, q);
+				}
+			}
+		}
+	}
+
+	/**
+	 *  @brief 畳み込み
+	 *    - 時間計算量: \f$ O((n+m) \log{(n+m)}) \f$
+	 *  @param[in] a  入力データ1。値は \f$ [0, 2\mathit{MOD}) \f$ であること。
+	 *  @param[in] b  入力データ2。値は \f$ [0, 2\mathit{MOD}) \f$ であること。
+	 *  @return    a と b の (巡回しない) 畳み込みを MOD で割った余り。
+	 *             長さは a.size() + b.size() - 1。
+	 */
+	std::vector<uint32_t> convolution(
+		std::vector<uint32_t> a, std::vector<uint32_t> b)
+	{
+		if(a.empty() || b.empty()){ return std::vector<uint32_t>(); }
+		const int k = a.size() + b.size() - 1;
+		int n = 1;
+		while(n < k){ n <<= 1; }
+		reserve(n);
+		a.resize(n);
+		b.resize(n);
+		transform(a.data(), n);
+		transform(b.data(), n);
+		for(int i = 0; i < n; ++i){
+			a[i] = reduction_type::multiply(a[i], b[i]);
+		}
+		inverse_transform(a.data(), n);
+		// 各点の積と逆変換で R^{-1} と n 倍が残るため R^2/n を掛ける
+		const uint32_t c = reduction_type::transform(
+			reduction_type::transform(power(n, MOD - 2)));
+		a.resize(k);
+		for(int i = 0; i < k; ++i){
+			a[i] = reduction_type::normalize(reduction_type::multiply(a[i], c));
+		}
+		return a;
+	}
+
+};
+
+/**
+ *  @brief 数論変換
+ *    - 時間計算量: \f$ O(n \log{n}) \f$
+ *
+ *  @param[in] f        入力データ (要素数が2冪であること)
+ *  @param[in] inverse  逆変換フラグ
+ *  @return    f を数論 (逆) 変換した結果
+ */
+template <int MOD>
+std::vector<ModulusInteger<MOD>> number_theoretic_transform(
+	const std::vector<ModulusInteger<MOD>> &f, bool inverse)
+{
+	typedef MontgomeryReduction<MOD> reduction_type;
+	const int n = f.size();
+	assert((n & (n - 1)) == 0);
+	auto &ntt = NumberTheoreticTransform<MOD>::shared();
+	ntt.reserve(n);
+	std::vector<uint32_t> a(n);
+	int bits = 0;
+	while((1 << bits) < n){ ++bits; }
+	const auto reverse = [bits](int i){
+		int j = 0;
+		for(int k = 0; k < bits; ++k){ j |= ((i >> k) & 1) << (bits - 1 - k); }
+		return j;
+	};
+	if(inverse){
+		for(int i = 0; i < n; ++i){ a[reverse(i)] = *f[i]; }
+		ntt.inverse_transform(a.data(), n);
+	}else{
+		for(int i = 0; i < n; ++i){ a[i] = *f[i]; }
+		ntt.transform(a.data(), n);
+	}
+	const uint32_t c = reduction_type::transform(
+		inverse ? *(ModulusInteger<MOD>(1) / ModulusInteger<MOD>(n)) : 1);
+	std::vector<ModulusInteger<MOD>> result(n);
+	for(int i = 0; i < n; ++i){
+		const uint32_t x =
+			reduction_type::normalize(reduction_type::multiply(a[i], c));
+		result[inverse ? i : reverse(i)] = ModulusInteger<MOD>(x);
+	}
+	return result;
+}
+
+/**
+ *  @}
+ */
+
+}
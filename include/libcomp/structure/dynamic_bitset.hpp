@@ -0,0 +1,282 @@
+/**
+ *  @file libcomp/structure/dynamic_bitset.hpp
+ */
+#pragma once
+#include <vector>
+#include <cstdint>
+
+namespace lc {
+
+/**
+ *  @defgroup dynamic_bitset Dynamic bitset
+ *  @brief    実行時に長さを決めるビット列
+ *  @ingroup  structure
+ *  @{
+ */
+
+/**
+ *  @brief 実行時に長さを決めるビット列
+ *
+ *  64 ビットのワード列としてビットを保持し、集合演算をワード単位で行う。
+ *  二項演算は同じ長さのビット列同士でのみ行える。
+ *  長さを超えた部分のビットは常に 0 に保たれる。
+ */
+class DynamicBitset {
+
+private:
+	int m_size;
+	std::vector<uint64_t> m_words;
+
+	static int word_count(int n){ return (n + 63) >> 6; }
+
+	void trim(){
+		if(m_size & 63){ m_words.back() &= (1ull << (m_size & 63)) - 1; }
+	}
+
+public:
+	/**
+	 *  @brief コンストラクタ
+	 *  @param[in] n      ビット列の長さ
+	 *  @param[in] value  全ビットの初期値
+	 */
+	explicit DynamicBitset(int n = 0, bool value = false)
+		: m_size(n)
+		, m_words(word_count(n), value ? ~0ull : 0ull)
+	{
+		trim();
+	}
+
+	/**
+	 *  @brief  ビット列の長さの取得
+	 *  @return ビット列の長さ
+	 */
+	int size() const { return m_size; }
+
+	/**
+	 *  @brief  ワード列の取得
+	 *  @return 下位ビットから順に 64 ビットずつ格納したワード列
+	 */
+	const std::vector<uint64_t> &words() const { return m_words; }
+
+	/**
+	 *  @brief ビットの参照
+	 *  @param[in] i  ビットの位置
+	 *  @return    i 番目のビットが 1 ならば true
+	 */
+	bool test(int i) const { return (m_words[i >> 6] >> (i & 63)) & 1; }
+
+	/**
+	 *  @brief ビットを 1 にする
+	 *  @param[in] i  ビットの位置
+	 */
+	void set(int i){ m_words[i >> 6] |= (1ull << (i & 63)); }
+
+	/**
+	 *  @brief ビットを 0 にする
+	 *  @param[in] i  ビットの位置
+	 */
+	void reset(int i){ m_words[i >> 6] &= ~(1ull << (i & 63)); }
+
+	/**
+	 *  @brief 全ビットを 0 にする
+	 */
+	void clear(){
+		for(auto &w : m_words){ w = 0; }
+	}
+
+	/**
+	 *  @brief  1 であるビットの数え上げ
+	 *  @return 1 であるビットの数
+	 */
+	int count() const {
+		int result = 0;
+		for(const auto w : m_words){ result += __builtin_popcountll(w); }
+		return result;
+	}
+
+	/**
+	 *  @brief  1 であるビットが存在するかの判定
+	 *  @return 1 であるビットが存在すれば true
+	 */
+	bool any() const {
+		for(const auto w : m_words){
+			if(w){ return true; }
+		}
+		return false;
+	}
+
+	/**
+	 *  @brief 位置 i 以降で最初に 1 であるビットの探索
+	 *  @param[in] i  探索を開始する位置
+	 *  @return    i 以降で最初に 1 であるビットの位置。存在しない場合は size()。
+	 */
+	int find_next(int i) const {
+		if(i >= m_size){ return m_size; }
+		int k = i >> 6;
+		uint64_t w = m_words[k] & (~0ull << (i & 63));
+		const int n = m_words.size();
+		while(!w){
+			if(++k == n){ return m_size; }
+			w = m_words[k];
+		}
+		return (k << 6) + __builtin_ctzll(w);
+	}
+
+	/**
+	 *  @brief  最初に 1 であるビットの探索
+	 *  @return 最初に 1 であるビットの位置。存在しない場合は size()。
+	 */
+	int find_first() const { return find_next(0); }
+
+	/**
+	 *  @brief 論理積の代入
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this
+	 */
+	DynamicBitset &operator&=(const DynamicBitset &x){
+		for(size_t k = 0; k < m_words.size(); ++k){
+			m_words[k] &= x.m_words[k];
+		}
+		return *this;
+	}
+
+	/**
+	 *  @brief 論理和の代入
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this
+	 */
+	DynamicBitset &operator|=(const DynamicBitset &x){
+		for(size_t k = 0; k < m_words.size(); ++k){
+			m_words[k] |= x.m_words[k];
+		}
+		return *this;
+	}
+
+	/**
+	 *  @brief 排他的論理和の代入
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this
+	 */
+	DynamicBitset &operator^=(const DynamicBitset &x){
+		for(size_t k = 0; k < m_words.size(); ++k){
+			m_words[k] ^= x.m_words[k];
+		}
+		return *this;
+	}
+
+	/**
+	 *  @brief 差集合の代入
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this
+	 */
+	DynamicBitset &and_not(const DynamicBitset &x){
+		for(size_t k = 0; k < m_words.size(); ++k){
+			m_words[k] &= ~x.m_words[k];
+		}
+		return *this;
+	}
+
+	/**
+	 *  @brief 論理積の代入
+	 *
+	 *  *this を a と b の論理積で上書きする。一時オブジェクトを作らない。
+	 *
+	 *  @param[in] a  同じ長さのビット列
+	 *  @param[in] b  同じ長さのビット列
+	 *  @return    *this
+	 */
+	DynamicBitset &assign_and(const DynamicBitset &a, const DynamicBitset &b){
+		for(size_t k = 0; k < m_words.size(); ++k){
+			m_words[k] = a.m_words[k] & b.m_words[k];
+		}
+		return *this;
+	}
+
+	/**
+	 *  @brief 全ビットの反転
+	 *  @return *this
+	 */
+	DynamicBitset &flip(){
+		for(auto &w : m_words){ w = ~w; }
+		trim();
+		return *this;
+	}
+
+	/**
+	 *  @brief 論理積に含まれる 1 の数え上げ
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this と x の論理積に含まれる 1 であるビットの数
+	 */
+	int count_and(const DynamicBitset &x) const {
+		int result = 0;
+		for(size_t k = 0; k < m_words.size(); ++k){
+			result += __builtin_popcountll(m_words[k] & x.m_words[k]);
+		}
+		return result;
+	}
+
+	/**
+	 *  @brief 共通部分の有無の判定
+	 *  @param[in] x  同じ長さのビット列
+	 *  @return    *this と x の両方で 1 であるビットが存在すれば true
+	 */
+	bool intersects(const DynamicBitset &x) const {
+		for(size_t k = 0; k < m_words.size(); ++k){
+			if(m_words[k] & x.m_words[k]){ return true; }
+		}
+		return false;
+	}
+
+	/**
+	 *  @brief 等価比較
+	 *  @param[in] x  比較対象のビット列
+	 *  @return    長さと全ビットが等しければ true
+	 */
+	bool operator==(const DynamicBitset &x) const {
+		return m_size == x.m_size && m_words == x.m_words;
+	}
+
+	/**
+	 *  @brief 非等価比較
+	 *  @param[in] x  比較対象のビット列
+	 *  @return    長さまたはいずれかのビットが異なれば true
+	 */
+	bool operator!=(const DynamicBitset &x) const { return !(*this == x); }
+
+};
+
+/**
+ *  @brief 論理積
+ *  @param[in] a  ビット列
+ *  @param[in] b  a と同じ長さのビット列
+ *  @return    a と b の論理積
+ */
+inline DynamicBitset operator&(DynamicBitset a, const DynamicBitset &b){
+	return a &= b;
+}
+
+/**
+ *  @brief 論理和
+ *  @param[in] a  ビット列
+ *  @param[in] b  a と同じ長さのビット列
+ *  @return    a と b の論理和
+ */
+inline DynamicBitset operator|(DynamicBitset a, const DynamicBitset &b){
+	return a |= b;
+}
+
+/**
+ *  @brief 排他的論理和
+ *  @param[in] a  ビット列
+ *  @param[in] b  a と同じ長さのビット列
+ *  @return    a と b の排他的論理和
+ */
+inline DynamicBitset operator^(DynamicBitset a, const DynamicBitset &b){
+	return a ^= b;
+}
+
+/**
+ *  @}
+ */
+
+}
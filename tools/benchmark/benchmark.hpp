@@ -0,0 +1,27 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+
+namespace benchmark {
+
+// 関数の実行にかかった時間を秒単位で返す
+template <typename Func>
+double measure(Func func){
+	const auto start = std::chrono::steady_clock::now();
+	func();
+	const auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(stop - start).count();
+}
+
+// 2つの実装の結果と時間を1行に出力する
+inline void report(
+	const char *name, const char *first, double first_time,
+	const char *second, double second_time, bool agree)
+{
+	std::printf(
+		"%-36s %s %8.3f s  %s %8.3f s  %s\n",
+		name, first, first_time, second, second_time,
+		agree ? "" : "MISMATCH");
+}
+
+}
@@ -0,0 +1,102 @@
+#include <cstdio>
+#include <string>
+#include <random>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/maxflow_dinic.hpp"
+#include "libcomp/graph/maxflow_push_relabel.hpp"
+#include "benchmark.hpp"
+
+typedef lc::EdgeWithCapacity<long long> edge_type;
+typedef lc::AdjacencyList<edge_type> graph_type;
+
+// 始点を 0、終点を n-1 とし、各頂点対に確率 p で辺を張る
+graph_type dense_graph(int n, double p, long long max_capacity){
+	std::mt19937 engine(n);
+	std::bernoulli_distribution coin(p);
+	std::uniform_int_distribution<long long> capacity(1, max_capacity);
+	graph_type graph(n);
+	for(int u = 0; u < n; ++u){
+		for(int v = 0; v < n; ++v){
+			if(u == v || !coin(engine)){ continue; }
+			graph.add_edge(u, v, capacity(engine));
+		}
+	}
+	return graph;
+}
+
+// 幅 width の層を layers 個並べ、各頂点から次の層の頂点へ degree 本の辺を
+// 張る。始点は 0、終点は最後の頂点で、最後の層から終点への辺の容量は
+// sink_capacity とする。
+graph_type layered_graph(
+	int layers, int width, int degree, long long max_capacity,
+	long long sink_capacity)
+{
+	std::mt19937 engine(layers * width + degree);
+	std::uniform_int_distribution<int> column(0, width - 1);
+	std::uniform_int_distribution<long long> capacity(1, max_capacity);
+	const int n = layers * width + 2, source = 0, sink = n - 1;
+	graph_type graph(n);
+	for(int i = 0; i < width; ++i){
+		graph.add_edge(source, 1 + i, max_capacity * degree);
+		graph.add_edge(1 + (layers - 1) * width + i, sink, sink_capacity);
+	}
+	for(int l = 0; l + 1 < layers; ++l){
+		for(int i = 0; i < width; ++i){
+			const int u = 1 + l * width + i;
+			for(int j = 0; j < degree; ++j){
+				const int v = 1 + (l + 1) * width + column(engine);
+				graph.add_edge(u, v, capacity(engine));
+			}
+		}
+	}
+	return graph;
+}
+
+// 左右 half 頂点ずつの二部グラフで、左の各頂点から右へ degree 本の
+// 容量 1 の辺を張る (二部マッチング)
+graph_type bipartite_graph(int half, int degree){
+	std::mt19937 engine(half + degree);
+	std::uniform_int_distribution<int> right(0, half - 1);
+	const int n = 2 * half + 2, source = 0, sink = n - 1;
+	graph_type graph(n);
+	for(int i = 0; i < half; ++i){
+		graph.add_edge(source, 1 + i, 1);
+		graph.add_edge(1 + half + i, sink, 1);
+		for(int j = 0; j < degree; ++j){
+			graph.add_edge(1 + i, 1 + half + right(engine), 1);
+		}
+	}
+	return graph;
+}
+
+void run(const std::string &name, const graph_type &graph){
+	const int source = 0, sink = graph.size() - 1;
+	auto dinic_graph = lc::make_residual(graph);
+	auto push_relabel_graph = lc::make_residual(graph);
+	long long expected = 0, actual = 0;
+	const double dinic_time = benchmark::measure([&](){
+		expected = lc::maxflow_dinic(source, sink, dinic_graph);
+	});
+	const double push_relabel_time = benchmark::measure([&](){
+		actual = lc::maxflow_push_relabel(source, sink, push_relabel_graph);
+	});
+	benchmark::report(
+		name.c_str(), "dinic", dinic_time,
+		"push-relabel", push_relabel_time, expected == actual);
+}
+
+int main(){
+	const long long unbounded = 1ll << 50;
+	run("dense n=1500 p=0.5", dense_graph(1500, 0.5, 1000000));
+	run("layered 200x500 deg=3",
+		layered_graph(200, 500, 3, 1000000, unbounded));
+	run("layered 500x200 deg=10",
+		layered_graph(500, 200, 10, 1000000, unbounded));
+	run("layered 200x500 deg=3 sink-bound",
+		layered_graph(200, 500, 3, 1000000, 10));
+	run("layered 500x200 deg=10 sink-bound",
+		layered_graph(500, 200, 10, 1000000, 10));
+	run("bipartite 50000+50000 deg=5", bipartite_graph(50000, 5));
+	run("bipartite 200000+200000 deg=3", bipartite_graph(200000, 3));
+	return 0;
+}
@@ -0,0 +1,140 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/sssp_dijkstra.hpp"
+#include "libcomp/graph/strongly_connected_components.hpp"
+#include "libcomp/graph/vertex_ordering.hpp"
+#include "benchmark.hpp"
+
+typedef lc::EdgeWithWeight<long long> edge_type;
+typedef lc::AdjacencyList<edge_type> graph_type;
+
+// 各頂点から番号の近い頂点へ degree 本の辺を張る (帯幅 band)
+graph_type banded_graph(int n, int degree, int band){
+	std::mt19937 engine(n);
+	std::uniform_int_distribution<int> offset(-band, band);
+	std::uniform_int_distribution<long long> weight(1, 100);
+	graph_type graph(n);
+	for(int u = 0; u < n; ++u){
+		for(int i = 0; i < degree; ++i){
+			const int v = std::min(std::max(u + offset(engine), 0), n - 1);
+			graph.add_edge(u, v, weight(engine));
+		}
+	}
+	return graph;
+}
+
+// width x height の格子で隣接する頂点間に辺を張る。
+// 各辺は確率 1/2 で双方向、それ以外は片方向とする。
+graph_type grid_graph(int width, int height){
+	std::mt19937 engine(width);
+	std::uniform_int_distribution<int> direction(0, 3);
+	std::uniform_int_distribution<long long> weight(1, 100);
+	graph_type graph(width * height);
+	const auto connect = [&](int u, int v){
+		const int d = direction(engine);
+		if(d != 1){ graph.add_edge(u, v, weight(engine)); }
+		if(d != 0){ graph.add_edge(v, u, weight(engine)); }
+	};
+	for(int y = 0; y < height; ++y){
+		for(int x = 0; x < width; ++x){
+			const int u = y * width + x;
+			if(x + 1 < width){ connect(u, u + 1); }
+			if(y + 1 < height){ connect(u, u + width); }
+		}
+	}
+	return graph;
+}
+
+// 各頂点から一様ランダムに degree 本の辺を張る
+graph_type random_graph(int n, int degree){
+	std::mt19937 engine(n + 1);
+	std::uniform_int_distribution<int> vertex(0, n - 1);
+	std::uniform_int_distribution<long long> weight(1, 100);
+	graph_type graph(n);
+	for(int u = 0; u < n; ++u){
+		for(int i = 0; i < degree; ++i){
+			graph.add_edge(u, vertex(engine), weight(engine));
+		}
+	}
+	return graph;
+}
+
+// 頂点番号をランダムに並べ替える
+graph_type shuffle(const graph_type &graph){
+	std::vector<int> new_id(graph.size());
+	for(size_t i = 0; i < new_id.size(); ++i){ new_id[i] = i; }
+	std::mt19937 engine(graph.size());
+	std::shuffle(new_id.begin(), new_id.end(), engine);
+	return lc::relabel_vertices(graph, new_id);
+}
+
+// 2つの成分分解が同じ分割を表しているかの判定
+bool same_partition(
+	const lc::StronglyConnectedComponents &a,
+	const lc::StronglyConnectedComponents &b,
+	const std::vector<int> &new_id)
+{
+	if(a.size() != b.size()){ return false; }
+	std::vector<int> mapping(a.size(), -1);
+	for(size_t v = 0; v < new_id.size(); ++v){
+		const int x = a.component_id(v), y = b.component_id(new_id[v]);
+		if(mapping[x] < 0){ mapping[x] = y; }
+		if(mapping[x] != y){ return false; }
+	}
+	return true;
+}
+
+void run(const std::string &name, const graph_type &original){
+	typedef std::function<std::vector<int>(const graph_type &)> ordering_type;
+	const graph_type graph = shuffle(original);
+	const int n = graph.size();
+	std::vector<int> identity(n);
+	for(int i = 0; i < n; ++i){ identity[i] = i; }
+	const std::vector<std::pair<const char *, ordering_type>> orderings = {
+		{ "shuffled", [&](const graph_type &){ return identity; } },
+		{ "bfs", lc::breadth_first_ordering<edge_type> },
+		{ "dfs", lc::depth_first_ordering<edge_type> },
+		{ "rcm", lc::reverse_cuthill_mckee_ordering<edge_type> },
+		{ "degree", lc::degree_ordering<edge_type> }
+	};
+	const std::vector<long long> expected = lc::sssp_dijkstra(0, graph);
+	const lc::StronglyConnectedComponents expected_scc(graph);
+	for(const auto &ordering : orderings){
+		std::vector<int> new_id;
+		graph_type relabeled;
+		const double relabel_time = benchmark::measure([&](){
+			new_id = ordering.second(graph);
+			relabeled = lc::relabel_vertices(graph, new_id);
+		});
+		std::vector<long long> dist;
+		const double dijkstra_time = benchmark::measure([&](){
+			dist = lc::sssp_dijkstra(new_id[0], relabeled);
+		});
+		lc::StronglyConnectedComponents scc;
+		const double scc_time = benchmark::measure([&](){
+			scc = lc::StronglyConnectedComponents(relabeled);
+		});
+		bool agree = same_partition(expected_scc, scc, new_id);
+		for(int v = 0; v < n; ++v){
+			if(dist[new_id[v]] != expected[v]){ agree = false; }
+		}
+		std::printf(
+			"%-28s %-8s relabel %7.3f s  "
+			"dijkstra %7.3f s  scc %7.3f s  %s\n",
+			name.c_str(), ordering.first, relabel_time, dijkstra_time,
+			scc_time, agree ? "" : "MISMATCH");
+	}
+}
+
+int main(){
+	const int n = 1 << 21;
+	run("banded n=2^21 deg=4 band=16", banded_graph(n, 4, 16));
+	run("grid 1448x1448", grid_graph(1448, 1448));
+	run("random n=2^21 deg=4", random_graph(n, 4));
+	return 0;
+}
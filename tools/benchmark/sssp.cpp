@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <string>
+#include <random>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/sssp_dijkstra.hpp"
+#include "libcomp/graph/sssp_delta_stepping.hpp"
+#include "benchmark.hpp"
+
+typedef lc::EdgeWithWeight<long long> edge_type;
+typedef lc::AdjacencyList<edge_type> graph_type;
+
+// 各頂点から一様ランダムに degree 本の辺を張る
+graph_type random_graph(int n, int degree, long long max_weight){
+	std::mt19937 engine(n);
+	std::uniform_int_distribution<int> vertex(0, n - 1);
+	std::uniform_int_distribution<long long> weight(1, max_weight);
+	graph_type graph(n);
+	for(int u = 0; u < n; ++u){
+		for(int i = 0; i < degree; ++i){
+			graph.add_edge(u, vertex(engine), weight(engine));
+		}
+	}
+	return graph;
+}
+
+// width x height の格子で隣接する頂点間に双方向の辺を張る
+graph_type grid_graph(int width, int height, long long max_weight){
+	std::mt19937 engine(width);
+	std::uniform_int_distribution<long long> weight(1, max_weight);
+	graph_type graph(width * height);
+	for(int y = 0; y < height; ++y){
+		for(int x = 0; x < width; ++x){
+			const int u = y * width + x;
+			if(x + 1 < width){
+				const long long w = weight(engine);
+				graph.add_edge(u, u + 1, w);
+				graph.add_edge(u + 1, u, w);
+			}
+			if(y + 1 < height){
+				const long long w = weight(engine);
+				graph.add_edge(u, u + width, w);
+				graph.add_edge(u + width, u, w);
+			}
+		}
+	}
+	return graph;
+}
+
+// 大半の辺の重みは小さく、ごく一部の辺だけ重みが max_weight となる
+graph_type skewed_graph(int n, int degree, long long max_weight){
+	graph_type graph = random_graph(n, degree, 100);
+	std::mt19937 engine(n + 1);
+	std::uniform_int_distribution<int> vertex(0, n - 1);
+	graph.add_edge(vertex(engine), vertex(engine), max_weight);
+	return graph;
+}
+
+void run(const std::string &name, const graph_type &graph){
+	std::vector<long long> expected, actual;
+	const double dijkstra_time = benchmark::measure([&](){
+		expected = lc::sssp_dijkstra(0, graph);
+	});
+	const double delta_time = benchmark::measure([&](){
+		actual = lc::sssp_delta_stepping(0, graph);
+	});
+	benchmark::report(
+		name.c_str(), "dijkstra", dijkstra_time,
+		"delta-stepping", delta_time, expected == actual);
+}
+
+int main(){
+	const int n = 1 << 21;
+	for(const long long w : { 100ll, 1000000000ll }){
+		const std::string suffix = " w<=" + std::to_string(w);
+		run("random n=2^21 deg=4" + suffix, random_graph(n, 4, w));
+		run("random n=2^21 deg=16" + suffix, random_graph(n, 16, w));
+		run("grid 1448x1448" + suffix, grid_graph(1448, 1448, w));
+	}
+	run("skewed n=2^21 deg=4 w<=10^9", skewed_graph(n, 4, 1000000000ll));
+	run("skewed n=2^16 deg=4 w<=10^9", skewed_graph(1 << 16, 4, 1000000000ll));
+	return 0;
+}
@@ -0,0 +1,52 @@
+// AOJ 0526 - Boat Travel
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/incremental_sssp.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+typedef lc::IncrementalShortestPaths<Edge> ShortestPaths;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	while(true){
+		int n, k;
+		cin >> n >> k;
+		if(n == 0 && k == 0){ break; }
+		const lc::AdjacencyList<Edge> empty(n);
+		vector<ShortestPaths> sp;
+		for(int s = 0; s < n; ++s){ sp.push_back(ShortestPaths(empty, s)); }
+		// 同じ島の組を結ぶ航路は既存の辺の重みを減らす
+		vector<vector<int>> edge_index(n, vector<int>(n, -1));
+		while(k--){
+			int type;
+			cin >> type;
+			if(type == 0){
+				int a, b;
+				cin >> a >> b;
+				--a; --b;
+				const bool ok = sp[a].reachable(b);
+				cout << (ok ? sp[a].distance(b) : -1) << endl;
+				continue;
+			}
+			int c, d, e;
+			cin >> c >> d >> e;
+			--c; --d;
+			if(edge_index[c][d] < 0){
+				edge_index[c][d] = sp[0].graph()[c].size();
+				edge_index[d][c] = sp[0].graph()[d].size();
+				for(auto &x : sp){
+					x.add_edge(c, d, e);
+					x.add_edge(d, c, e);
+				}
+			}else if(e < sp[0].graph()[c][edge_index[c][d]].weight){
+				for(auto &x : sp){
+					x.decrease_weight(c, edge_index[c][d], e);
+					x.decrease_weight(d, edge_index[d][c], e);
+				}
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,29 @@
+// AOJ ALDS1_11_C - Breadth First Search
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/breadth_first_search.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n;
+	cin >> n;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < n; ++i){
+		int u, k;
+		cin >> u >> k;
+		for(int j = 0; j < k; ++j){
+			int v;
+			cin >> v;
+			graph.add_edge(u - 1, v - 1);
+		}
+	}
+	lc::BreadthFirstSearch bfs;
+	bfs.run(graph, 0);
+	for(int v = 0; v < n; ++v){
+		cout << v + 1 << " " << bfs.distance(v) << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,43 @@
+// AOJ ALDS1_11_D - Connected Components
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/vertex_ordering.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		cin >> s >> t;
+		graph.add_edge(s, t);
+		graph.add_edge(t, s);
+	}
+	// 幅優先探索順では各連結成分が連続した番号を持ち、
+	// 成分の先頭以外の頂点は自身より小さい番号の隣接頂点を持つ
+	const vector<int> new_id = lc::breadth_first_ordering(graph);
+	const auto relabeled = lc::relabel_vertices(graph, new_id);
+	vector<int> component(n);
+	for(int u = 0, c = -1; u < n; ++u){
+		bool head = true;
+		for(const auto &e : relabeled[u]){
+			if(e.to < u){ head = false; }
+		}
+		if(head){ ++c; }
+		component[u] = c;
+	}
+	int q;
+	cin >> q;
+	while(q--){
+		int s, t;
+		cin >> s >> t;
+		const bool connected = component[new_id[s]] == component[new_id[t]];
+		cout << (connected ? "yes" : "no") << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,32 @@
+// AOJ ALDS1_12_C - Single Source Shortest Path II
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/vertex_ordering.hpp"
+#include "libcomp/graph/sssp_dijkstra.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n;
+	cin >> n;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < n; ++i){
+		int u, k;
+		cin >> u >> k;
+		for(int j = 0; j < k; ++j){
+			int v, c;
+			cin >> v >> c;
+			graph.add_edge(u, v, c);
+		}
+	}
+	const vector<int> new_id = lc::reverse_cuthill_mckee_ordering(graph);
+	const auto relabeled = lc::relabel_vertices(graph, new_id);
+	const vector<int> dist = lc::sssp_dijkstra(new_id[0], relabeled);
+	for(int v = 0; v < n; ++v){
+		cout << v << " " << dist[new_id[v]] << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,33 @@
+// AOJ GRL_1_B - Single Source Shortest Path (Negative Edges)
+#include <iostream>
+#include <limits>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/sssp_spfa.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m, r;
+	cin >> n >> m >> r;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t, d;
+		cin >> s >> t >> d;
+		graph.add_edge(s, t, d);
+	}
+	const auto dist = lc::sssp_spfa(r, graph);
+	if(dist.empty()){
+		cout << "NEGATIVE CYCLE" << endl;
+		return 0;
+	}
+	for(int i = 0; i < n; ++i){
+		if(dist[i] == numeric_limits<int>::max()){
+			cout << "INF" << "\n";
+		}else{
+			cout << dist[i] << "\n";
+		}
+	}
+	return 0;
+}
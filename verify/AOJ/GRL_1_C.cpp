@@ -0,0 +1,40 @@
+// AOJ GRL_1_C - All Pairs Shortest Path
+#include <iostream>
+#include <limits>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/apsp_johnson.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::EdgeWithWeight<ll> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		ll d;
+		cin >> s >> t >> d;
+		graph.add_edge(s, t, d);
+	}
+	const auto dist = lc::apsp_johnson(graph);
+	if(dist.rows() == 0){
+		cout << "NEGATIVE CYCLE" << endl;
+		return 0;
+	}
+	const ll inf = numeric_limits<ll>::max();
+	for(int i = 0; i < n; ++i){
+		for(int j = 0; j < n; ++j){
+			if(j > 0){ cout << " "; }
+			if(dist(i, j) == inf){
+				cout << "INF";
+			}else{
+				cout << dist(i, j);
+			}
+		}
+		cout << endl;
+	}
+	return 0;
+}
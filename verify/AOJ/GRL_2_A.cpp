@@ -0,0 +1,25 @@
+// AOJ GRL_2_A - Minimum Spanning Tree
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/minimum_spanning_tree.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t, w;
+		cin >> s >> t >> w;
+		graph.add_edge(s, t, w);
+	}
+	int answer = 0;
+	for(const auto &p : lc::minimum_spanning_tree_kruskal(graph)){
+		answer += graph[p.first][p.second].weight;
+	}
+	cout << answer << endl;
+	return 0;
+}
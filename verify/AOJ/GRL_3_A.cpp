@@ -0,0 +1,23 @@
+// AOJ GRL_3_A - Articulation Points
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/lowlink.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		cin >> s >> t;
+		graph.add_edge(s, t);
+		graph.add_edge(t, s);
+	}
+	const lc::Lowlink lowlink(graph);
+	for(const int v : lowlink.articulation_points()){ cout << v << endl; }
+	return 0;
+}
@@ -0,0 +1,33 @@
+// AOJ GRL_3_B - Bridges
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/lowlink.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+typedef pair<int, int> pii;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		cin >> s >> t;
+		graph.add_edge(s, t);
+		graph.add_edge(t, s);
+	}
+	const lc::Lowlink lowlink(graph);
+	vector<pii> bridges;
+	for(const auto &p : lowlink.bridges()){
+		const int u = p.first, v = graph[u][p.second].to;
+		bridges.push_back(pii(min(u, v), max(u, v)));
+	}
+	sort(bridges.begin(), bridges.end());
+	for(const auto &p : bridges){ cout << p.first << " " << p.second << endl; }
+	return 0;
+}
@@ -0,0 +1,24 @@
+// AOJ GRL_4_A - Cycle Detection for a Directed Graph
+#include <iostream>
+#include "libcomp/graph/bitset_graph.hpp"
+
+using namespace std;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::BitsetGraph graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		cin >> s >> t;
+		graph.add_edge(s, t);
+	}
+	const lc::BitsetGraph closure = graph.transitive_closure();
+	bool has_cycle = false;
+	for(int v = 0; v < n; ++v){
+		if(closure.has_edge(v, v)){ has_cycle = true; }
+	}
+	cout << (has_cycle ? 1 : 0) << endl;
+	return 0;
+}
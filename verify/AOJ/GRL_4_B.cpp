@@ -0,0 +1,27 @@
+// AOJ GRL_4_B - Topological Sort
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/topological_sort.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int s, t;
+		cin >> s >> t;
+		graph.add_edge(s, t);
+	}
+	const auto levels = lc::topological_levels(graph);
+	vector<vector<int>> buckets(n);
+	for(int v = 0; v < n; ++v){ buckets[levels[v]].push_back(v); }
+	for(const auto &b : buckets){
+		for(const int v : b){ cout << v << "\n"; }
+	}
+	return 0;
+}
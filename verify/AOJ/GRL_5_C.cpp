@@ -0,0 +1,32 @@
+// AOJ GRL_5_C - Lowest Common Ancestor
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/euler_tour_lowest_common_ancestor.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n;
+	cin >> n;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < n; ++i){
+		int k;
+		cin >> k;
+		for(int j = 0; j < k; ++j){
+			int c;
+			cin >> c;
+			graph.add_edge(i, c);
+		}
+	}
+	lc::EulerTourLowestCommonAncestor lca(0, graph);
+	int q;
+	cin >> q;
+	while(q--){
+		int u, v;
+		cin >> u >> v;
+		cout << lca.query(u, v) << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,22 @@
+// AOJ GRL_6_A - Maximum Flow
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/maxflow_push_relabel.hpp"
+
+using namespace std;
+typedef lc::EdgeWithCapacity<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int u, v, c;
+		cin >> u >> v >> c;
+		graph.add_edge(u, v, c);
+	}
+	auto residual = lc::make_residual(graph);
+	cout << lc::maxflow_push_relabel(0, n - 1, residual) << endl;
+	return 0;
+}
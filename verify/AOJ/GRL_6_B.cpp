@@ -0,0 +1,23 @@
+// AOJ GRL_6_B - Minimum Cost Flow
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/mincostflow_cost_scaling.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeightAndCapacity<int, int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m, f;
+	cin >> n >> m >> f;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int u, v, c, d;
+		cin >> u >> v >> c >> d;
+		graph.add_edge(u, v, d, c);
+	}
+	auto residual = lc::make_residual(graph);
+	const auto result = lc::mincostflow_cost_scaling(0, n - 1, f, residual);
+	cout << (result.first < f ? -1 : result.second) << endl;
+	return 0;
+}
@@ -0,0 +1,22 @@
+// AOJ GRL_7_A - Bipartite Matching
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/hopcroft_karp.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int x, y, m;
+	cin >> x >> y >> m;
+	lc::AdjacencyList<Edge> graph(x);
+	for(int i = 0; i < m; ++i){
+		int a, b;
+		cin >> a >> b;
+		graph.add_edge(a, b);
+	}
+	const lc::HopcroftKarp matching(graph, y);
+	cout << matching.size() << endl;
+	return 0;
+}
@@ -0,0 +1,35 @@
+// AtCoder Beginner Contest 007 C - 幅優先探索
+#include <iostream>
+#include <vector>
+#include <string>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/breadth_first_search.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int r, c, sy, sx, gy, gx;
+	cin >> r >> c >> sy >> sx >> gy >> gx;
+	vector<string> field(r);
+	for(int i = 0; i < r; ++i){ cin >> field[i]; }
+	lc::AdjacencyList<Edge> graph(r * c);
+	for(int y = 0; y < r; ++y){
+		for(int x = 0; x < c; ++x){
+			if(field[y][x] != '.'){ continue; }
+			if(x + 1 < c && field[y][x + 1] == '.'){
+				graph.add_edge(y * c + x, y * c + x + 1);
+				graph.add_edge(y * c + x + 1, y * c + x);
+			}
+			if(y + 1 < r && field[y + 1][x] == '.'){
+				graph.add_edge(y * c + x, (y + 1) * c + x);
+				graph.add_edge((y + 1) * c + x, y * c + x);
+			}
+		}
+	}
+	lc::BreadthFirstSearch bfs;
+	bfs.run_symmetric(graph, (sy - 1) * c + (sx - 1));
+	cout << bfs.distance((gy - 1) * c + (gx - 1)) << endl;
+	return 0;
+}
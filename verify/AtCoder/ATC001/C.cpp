@@ -0,0 +1,21 @@
+// AtCoder Typical Contest 001 C - 高速フーリエ変換
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "libcomp/math/fft_convolution.hpp"
+
+using namespace std;
+typedef long long ll;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n;
+	cin >> n;
+	vector<int> a(n + 1), b(n + 1);
+	for(int i = 1; i <= n; ++i){ cin >> a[i] >> b[i]; }
+	const vector<double> c = lc::fft_real_convolution(a, b);
+	for(int i = 1; i <= 2 * n; ++i){
+		cout << static_cast<ll>(round(c[i])) << "\n";
+	}
+	return 0;
+}
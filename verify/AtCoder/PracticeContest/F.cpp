@@ -0,0 +1,37 @@
+// AtCoder Library Practice Contest F - Convolution
+#include <iostream>
+#include <vector>
+#include "libcomp/math/modulus_integer.hpp"
+#include "libcomp/math/number_theoretic_transform.hpp"
+
+using namespace std;
+typedef lc::ModulusInteger<998244353> mint;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	int size = 1;
+	while(size < n + m - 1){ size <<= 1; }
+	vector<mint> a(size), b(size);
+	for(int i = 0; i < n; ++i){
+		int x;
+		cin >> x;
+		a[i] = mint(x);
+	}
+	for(int i = 0; i < m; ++i){
+		int x;
+		cin >> x;
+		b[i] = mint(x);
+	}
+	vector<mint> fa = lc::number_theoretic_transform(a, false);
+	const vector<mint> fb = lc::number_theoretic_transform(b, false);
+	for(int i = 0; i < size; ++i){ fa[i] *= fb[i]; }
+	const vector<mint> c = lc::number_theoretic_transform(fa, true);
+	for(int i = 0; i < n + m - 1; ++i){
+		if(i > 0){ cout << " "; }
+		cout << c[i];
+	}
+	cout << "\n";
+	return 0;
+}
@@ -0,0 +1,49 @@
+// Codeforces 1105E - Helping Hiasat
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "libcomp/graph/enumerate_maximal_cliques.hpp"
+#include "libcomp/string/name_table.hpp"
+
+using namespace std;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::NameTable name_table;
+	vector<lc::DynamicBitset> conflict(m, lc::DynamicBitset(m));
+	lc::DynamicBitset segment(m);
+	const auto flush = [&](){
+		for(int u = segment.find_first(); u < m; u = segment.find_next(u + 1)){
+			conflict[u] |= segment;
+		}
+		segment.clear();
+	};
+	for(int i = 0; i < n; ++i){
+		int type;
+		cin >> type;
+		if(type == 1){
+			flush();
+		}else{
+			string s;
+			cin >> s;
+			segment.set(name_table[s]);
+		}
+	}
+	flush();
+	// 同時に満足できる友人の集合は衝突関係の補グラフにおけるクリーク
+	vector<lc::DynamicBitset> adjacency(m);
+	for(int u = 0; u < m; ++u){
+		adjacency[u] = conflict[u];
+		adjacency[u].flip();
+		adjacency[u].reset(u);
+	}
+	int answer = 0;
+	lc::enumerate_maximal_cliques(adjacency, [&](const lc::DynamicBitset &c){
+		answer = max(answer, c.count());
+	});
+	cout << answer << endl;
+	return 0;
+}
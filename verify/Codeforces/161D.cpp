@@ -0,0 +1,25 @@
+// Codeforces 161D - Distance in Tree
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/centroid_decomposition.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, k;
+	cin >> n >> k;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i + 1 < n; ++i){
+		int a, b;
+		cin >> a >> b;
+		--a; --b;
+		graph.add_edge(a, b, 1);
+		graph.add_edge(b, a, 1);
+	}
+	const lc::CentroidDecomposition<Edge> decomposition(graph);
+	const long long within_k = decomposition.count_pairs_within(k);
+	cout << within_k - decomposition.count_pairs_within(k - 1) << endl;
+	return 0;
+}
@@ -0,0 +1,35 @@
+// Codeforces 342E - Xenia and Tree
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/centroid_decomposition.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i + 1 < n; ++i){
+		int a, b;
+		cin >> a >> b;
+		--a; --b;
+		graph.add_edge(a, b, 1);
+		graph.add_edge(b, a, 1);
+	}
+	const lc::CentroidDecomposition<Edge> decomposition(graph);
+	lc::NearestMarkedVertex<Edge> nearest(decomposition);
+	nearest.mark(0);
+	while(m--){
+		int t, v;
+		cin >> t >> v;
+		--v;
+		if(t == 1){
+			nearest.mark(v);
+		}else{
+			cout << nearest.nearest(v).first << "\n";
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,66 @@
+// Codeforces 343E - Pumping Stations
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/gomory_hu_tree.hpp"
+
+using namespace std;
+typedef lc::EdgeWithCapacity<int> Edge;
+
+// Gomory-Hu 木の辺 v-parent(v) を番号 v で表す
+lc::GomoryHuTree<Edge> gh;
+vector<vector<int>> incident;
+vector<bool> alive;
+vector<int> order;
+
+void collect(int u, int from, vector<int> &edges){
+	for(const int e : incident[u]){
+		if(e == from || !alive[e]){ continue; }
+		edges.push_back(e);
+		collect(e == u ? gh.parent(e) : e, e, edges);
+	}
+}
+
+void solve(int root){
+	vector<int> edges;
+	collect(root, -1, edges);
+	if(edges.empty()){
+		order.push_back(root);
+		return;
+	}
+	int best = edges[0];
+	for(const int e : edges){
+		if(gh.weight(e) < gh.weight(best)){ best = e; }
+	}
+	alive[best] = false;
+	solve(best);
+	solve(gh.parent(best));
+}
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int a, b, c;
+		cin >> a >> b >> c;
+		graph.add_edge(a - 1, b - 1, c);
+		graph.add_edge(b - 1, a - 1, c);
+	}
+	gh = lc::GomoryHuTree<Edge>(graph);
+	incident.assign(n, vector<int>());
+	alive.assign(n, true);
+	long long total = 0;
+	for(int v = 1; v < n; ++v){
+		total += gh.weight(v);
+		incident[v].push_back(v);
+		incident[gh.parent(v)].push_back(v);
+	}
+	solve(0);
+	cout << total << endl;
+	for(int i = 0; i < n; ++i){
+		cout << order[i] + 1 << (i + 1 == n ? "\n" : " ");
+	}
+	return 0;
+}
@@ -0,0 +1,24 @@
+// Library Checker - Assignment Problem
+#include <iostream>
+#include <vector>
+#include "libcomp/math/matrix.hpp"
+#include "libcomp/graph/hungarian.hpp"
+
+using namespace std;
+typedef long long ll;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n;
+	cin >> n;
+	lc::Matrix<ll> cost(n, n);
+	for(int i = 0; i < n; ++i){
+		for(int j = 0; j < n; ++j){ cin >> cost(i, j); }
+	}
+	const auto result = lc::hungarian(cost);
+	cout << result.first << endl;
+	for(int i = 0; i < n; ++i){
+		cout << result.second[i] << (i + 1 == n ? "\n" : " ");
+	}
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Library Checker - Biconnected Components
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/lowlink.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int a, b;
+		cin >> a >> b;
+		graph.add_edge(a, b);
+		graph.add_edge(b, a);
+	}
+	const lc::Lowlink lowlink(graph);
+	cout << lowlink.block_count() << "\n";
+	for(int b = 0; b < lowlink.block_count(); ++b){
+		cout << lowlink.block_size(b);
+		for(int i = 0; i < lowlink.block_size(b); ++i){
+			cout << " " << lowlink.block_vertex(b, i);
+		}
+		cout << "\n";
+	}
+	return 0;
+}
@@ -0,0 +1,32 @@
+// Library Checker - Convolution (Mod 1,000,000,007)
+#include <iostream>
+#include <vector>
+#include "libcomp/math/modulus_integer.hpp"
+#include "libcomp/math/ntt_convolution.hpp"
+
+using namespace std;
+typedef lc::ModulusInteger<1000000007> mint;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	vector<mint> a(n), b(m);
+	for(int i = 0; i < n; ++i){
+		int x;
+		cin >> x;
+		a[i] = mint(x);
+	}
+	for(int i = 0; i < m; ++i){
+		int x;
+		cin >> x;
+		b[i] = mint(x);
+	}
+	const vector<mint> c = lc::arbitrary_modulus_convolution(a, b);
+	for(int i = 0; i < n + m - 1; ++i){
+		if(i > 0){ cout << " "; }
+		cout << c[i];
+	}
+	cout << "\n";
+	return 0;
+}
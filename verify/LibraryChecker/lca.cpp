@@ -0,0 +1,28 @@
+// Library Checker - Lowest Common Ancestor
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/offline_lowest_common_ancestor.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+typedef pair<int, int> pii;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, q;
+	cin >> n >> q;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 1; i < n; ++i){
+		int p;
+		cin >> p;
+		graph.add_edge(p, i);
+	}
+	vector<pii> queries(q);
+	for(int i = 0; i < q; ++i){ cin >> queries[i].first >> queries[i].second; }
+	const vector<int> answer =
+		lc::offline_lowest_common_ancestor(0, graph, queries);
+	for(int i = 0; i < q; ++i){ cout << answer[i] << "\n"; }
+	return 0;
+}
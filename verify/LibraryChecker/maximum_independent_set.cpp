@@ -0,0 +1,33 @@
+// Library Checker - Maximum Independent Set
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/enumerate_maximal_independent_sets.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int u, v;
+		cin >> u >> v;
+		graph.add_edge(u, v);
+	}
+	lc::DynamicBitset best(n);
+	lc::enumerate_maximal_independent_sets_dynamic(
+		graph, [&](const lc::DynamicBitset &s){
+			if(s.count() > best.count()){ best = s; }
+		});
+	cout << best.count() << "\n";
+	for(int v = best.find_first(), first = 1; v < n; v = best.find_next(v + 1)){
+		if(!first){ cout << " "; }
+		cout << v;
+		first = 0;
+	}
+	cout << "\n";
+	return 0;
+}
@@ -0,0 +1,34 @@
+// Library Checker - Minimum Spanning Tree
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/minimum_spanning_tree.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::EdgeWithWeight<ll> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	vector<vector<int>> edge_id(n);
+	for(int i = 0; i < m; ++i){
+		int a, b;
+		ll c;
+		cin >> a >> b >> c;
+		graph.add_edge(a, b, c);
+		edge_id[a].push_back(i);
+	}
+	const auto tree = lc::minimum_spanning_tree_boruvka(graph);
+	ll total = 0;
+	for(const auto &p : tree){ total += graph[p.first][p.second].weight; }
+	cout << total << "\n";
+	for(size_t i = 0; i < tree.size(); ++i){
+		if(i > 0){ cout << " "; }
+		cout << edge_id[tree[i].first][tree[i].second];
+	}
+	cout << "\n";
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Library Checker - Strongly Connected Components
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/strongly_connected_components.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int a, b;
+		cin >> a >> b;
+		graph.add_edge(a, b);
+	}
+	const lc::StronglyConnectedComponents scc(graph);
+	vector<vector<int>> groups(scc.size());
+	for(int v = 0; v < n; ++v){ groups[scc.component_id(v)].push_back(v); }
+	cout << scc.size() << "\n";
+	for(const auto &g : groups){
+		cout << g.size();
+		for(const int v : g){ cout << " " << v; }
+		cout << "\n";
+	}
+	return 0;
+}
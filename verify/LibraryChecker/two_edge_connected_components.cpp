@@ -0,0 +1,36 @@
+// Library Checker - Two-Edge-Connected Components
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/two_edge_connected_components.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int a, b;
+		cin >> a >> b;
+		graph.add_edge(a, b);
+		graph.add_edge(b, a);
+	}
+	const vector<int> tcc = lc::two_edge_connected_components(graph);
+	vector<vector<int>> groups(n);
+	for(int v = 0; v < n; ++v){ groups[tcc[v]].push_back(v); }
+	int k = 0;
+	for(const auto &g : groups){
+		if(!g.empty()){ ++k; }
+	}
+	cout << k << "\n";
+	for(const auto &g : groups){
+		if(g.empty()){ continue; }
+		cout << g.size();
+		for(const int v : g){ cout << " " << v; }
+		cout << "\n";
+	}
+	return 0;
+}
@@ -0,0 +1,42 @@
+// Library Checker - Vertex Add Path Sum
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/tree_path_query.hpp"
+#include "libcomp/structure/lazy_traits/sum_add.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::Edge Edge;
+typedef lc::TreePathQuery<lc::LazySumRangeAddTraits<ll>, true> PathQuery;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, q;
+	cin >> n >> q;
+	vector<ll> a(n);
+	for(int i = 0; i < n; ++i){ cin >> a[i]; }
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i + 1 < n; ++i){
+		int u, v;
+		cin >> u >> v;
+		graph.add_edge(u, v);
+		graph.add_edge(v, u);
+	}
+	PathQuery pq(graph, 0, a);
+	while(q--){
+		int type;
+		cin >> type;
+		if(type == 0){
+			int p;
+			ll x;
+			cin >> p >> x;
+			pq.modify_path(p, p, x);
+		}else{
+			int u, v;
+			cin >> u >> v;
+			cout << pq.query_path(u, v) << "\n";
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,39 @@
+// Library Checker - Vertex Add Subtree Sum
+#include <iostream>
+#include <vector>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/euler_tour.hpp"
+#include "libcomp/structure/binary_indexed_tree.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, q;
+	cin >> n >> q;
+	vector<ll> a(n);
+	for(int i = 0; i < n; ++i){ cin >> a[i]; }
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 1; i < n; ++i){
+		int p;
+		cin >> p;
+		graph.add_edge(p, i);
+	}
+	const lc::EulerTour tour(graph);
+	lc::BinaryIndexedTree<ll> bit(n);
+	for(int v = 0; v < n; ++v){ bit.modify(tour.tin(v), a[v]); }
+	while(q--){
+		int type, u;
+		cin >> type >> u;
+		if(type == 0){
+			ll x;
+			cin >> x;
+			bit.modify(tour.tin(u), x);
+		}else{
+			cout << bit.query(tour.tout(u)) - bit.query(tour.tin(u)) << "\n";
+		}
+	}
+	return 0;
+}
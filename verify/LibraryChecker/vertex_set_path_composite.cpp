@@ -0,0 +1,84 @@
+// Library Checker - Vertex Set Path Composite
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/tree_path_query.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::Edge Edge;
+
+const ll MOD = 998244353;
+
+// x -> first * x + second
+typedef pair<ll, ll> Linear;
+
+struct CompositeTraits {
+	typedef Linear value_type;
+	typedef pair<bool, Linear> modifier_type;
+
+	value_type default_value() const { return Linear(1, 0); }
+	modifier_type default_modifier() const {
+		return modifier_type(false, default_value());
+	}
+	pair<modifier_type, modifier_type>
+	split_modifier(const modifier_type &m, size_t) const {
+		return make_pair(m, m);
+	}
+	modifier_type merge_modifier(
+		const modifier_type &a, const modifier_type &b) const
+	{
+		return b.first ? b : a;
+	}
+	value_type operator()(const value_type &f, const value_type &g) const {
+		return Linear(
+			g.first * f.first % MOD, (g.first * f.second + g.second) % MOD);
+	}
+	value_type resolve(
+		size_t n, const value_type &v, const modifier_type &m) const
+	{
+		if(!m.first){ return v; }
+		value_type x = m.second, y = default_value();
+		for(; n > 0; n >>= 1){
+			if(n & 1){ y = (*this)(y, x); }
+			x = (*this)(x, x);
+		}
+		return y;
+	}
+};
+
+typedef lc::TreePathQuery<CompositeTraits> PathQuery;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, q;
+	cin >> n >> q;
+	vector<Linear> f(n);
+	for(int i = 0; i < n; ++i){ cin >> f[i].first >> f[i].second; }
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i + 1 < n; ++i){
+		int u, v;
+		cin >> u >> v;
+		graph.add_edge(u, v);
+		graph.add_edge(v, u);
+	}
+	PathQuery pq(graph, 0, f);
+	while(q--){
+		int type;
+		cin >> type;
+		if(type == 0){
+			int p;
+			Linear g;
+			cin >> p >> g.first >> g.second;
+			pq.modify_path(p, p, make_pair(true, g));
+		}else{
+			int u, v;
+			ll x;
+			cin >> u >> v >> x;
+			const Linear h = pq.query_path(u, v);
+			cout << (h.first * x + h.second) % MOD << "\n";
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,35 @@
+// SPOJ 31 - Fast Multiplication of Polynomials (POLYMUL)
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include "libcomp/math/fast_fourier_transform.hpp"
+
+using namespace std;
+typedef long long ll;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int T;
+	cin >> T;
+	while(T--){
+		int n;
+		cin >> n;
+		const int k = 2 * n + 1;
+		int size = 2;
+		while(size < k){ size <<= 1; }
+		vector<double> a(size), b(size);
+		for(int i = 0; i <= n; ++i){ cin >> a[i]; }
+		for(int i = 0; i <= n; ++i){ cin >> b[i]; }
+		auto fa = lc::real_fast_fourier_transform(a);
+		const auto fb = lc::real_fast_fourier_transform(b);
+		for(int i = 0; i <= size / 2; ++i){ fa[i] *= fb[i]; }
+		const auto c = lc::inverse_real_fast_fourier_transform(fa, size);
+		for(int i = 0; i < k; ++i){
+			if(i > 0){ cout << " "; }
+			cout << static_cast<ll>(round(c[i]));
+		}
+		cout << "\n";
+	}
+	return 0;
+}
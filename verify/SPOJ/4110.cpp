@@ -0,0 +1,25 @@
+// SPOJ 4110 - Fast Maximum Flow (FASTFLOW)
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/maxflow_dinic.hpp"
+
+using namespace std;
+typedef long long ll;
+typedef lc::EdgeWithCapacity<ll> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int n, m;
+	cin >> n >> m;
+	lc::AdjacencyList<Edge> graph(n);
+	for(int i = 0; i < m; ++i){
+		int a, b, c;
+		cin >> a >> b >> c;
+		if(a == b){ continue; }
+		graph.add_edge(a - 1, b - 1, c);
+		graph.add_edge(b - 1, a - 1, c);
+	}
+	auto residual = lc::make_residual(graph);
+	cout << lc::maxflow_dinic(0, n - 1, residual, true) << endl;
+	return 0;
+}
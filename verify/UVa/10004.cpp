@@ -0,0 +1,25 @@
+// UVa 10004 - Bicoloring
+#include <iostream>
+#include "libcomp/graph/bitset_graph.hpp"
+
+using namespace std;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	while(true){
+		int n, l;
+		cin >> n;
+		if(n == 0){ break; }
+		cin >> l;
+		lc::BitsetGraph graph(n);
+		for(int i = 0; i < l; ++i){
+			int a, b;
+			cin >> a >> b;
+			graph.add_edge(a, b);
+			graph.add_edge(b, a);
+		}
+		const bool bipartite = graph.is_bipartite();
+		cout << (bipartite ? "BICOLORABLE." : "NOT BICOLORABLE.") << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,42 @@
+// UVa 10480 - Sabotage
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/maxflow_dinic.hpp"
+#include "libcomp/graph/min_cut.hpp"
+
+using namespace std;
+typedef lc::EdgeWithCapacity<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	while(true){
+		int n, m;
+		cin >> n >> m;
+		if(n == 0 && m == 0){ break; }
+		lc::AdjacencyList<Edge> graph(n);
+		vector<int> a(m), b(m);
+		vector<vector<int>> id(n);
+		for(int i = 0; i < m; ++i){
+			int c;
+			cin >> a[i] >> b[i] >> c;
+			const int u = a[i] - 1, v = b[i] - 1;
+			graph.add_edge(u, v, c);
+			id[u].push_back(i);
+			graph.add_edge(v, u, c);
+			id[v].push_back(i);
+		}
+		auto residual = lc::make_residual(graph);
+		lc::maxflow_dinic(0, 1, residual);
+		const auto source_side = lc::min_cut(0, residual);
+		vector<int> answer;
+		for(const auto &p : lc::cut_edges(graph, source_side)){
+			answer.push_back(id[p.first][p.second]);
+		}
+		sort(answer.begin(), answer.end());
+		for(const int i : answer){ cout << a[i] << " " << b[i] << endl; }
+		cout << endl;
+	}
+	return 0;
+}
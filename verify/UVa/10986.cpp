@@ -0,0 +1,40 @@
+// UVa 10986 - Sending email
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <limits>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/graph_serialization.hpp"
+#include "libcomp/graph/sssp_dijkstra.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int T;
+	cin >> T;
+	for(int case_num = 1; case_num <= T; ++case_num){
+		int n, m, s, t;
+		cin >> n >> m >> s >> t;
+		lc::AdjacencyList<Edge> graph(n);
+		for(int i = 0; i < m; ++i){
+			int a, b, w;
+			cin >> a >> b >> w;
+			graph.add_edge(a, b, w);
+			graph.add_edge(b, a, w);
+		}
+		stringstream ss(ios_base::in | ios_base::out | ios_base::binary);
+		lc::write_binary_graph(ss, graph);
+		const auto restored = lc::read_binary_graph<Edge>(ss);
+		if(!ss){ return 1; }
+		const vector<int> dist = lc::sssp_dijkstra(s, restored);
+		cout << "Case #" << case_num << ": ";
+		if(dist[t] == numeric_limits<int>::max()){
+			cout << "unreachable" << endl;
+		}else{
+			cout << dist[t] << endl;
+		}
+	}
+	return 0;
+}
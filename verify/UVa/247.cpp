@@ -0,0 +1,45 @@
+// UVa 247 - Calling Circles
+#include <iostream>
+#include <vector>
+#include <string>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/incremental_reachability.hpp"
+#include "libcomp/string/name_table.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+typedef lc::IncrementalReachability<Edge> Reachability;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	for(int case_num = 1; ; ++case_num){
+		int n, m;
+		cin >> n >> m;
+		if(n == 0 && m == 0){ break; }
+		const lc::AdjacencyList<Edge> empty(n);
+		vector<Reachability> reach;
+		for(int s = 0; s < n; ++s){ reach.push_back(Reachability(empty, s)); }
+		lc::NameTable name_table;
+		for(int i = 0; i < m; ++i){
+			string a, b;
+			cin >> a >> b;
+			const int u = name_table[a], v = name_table[b];
+			for(auto &r : reach){ r.add_edge(u, v); }
+		}
+		if(case_num > 1){ cout << endl; }
+		cout << "Calling circles for data set " << case_num << ":" << endl;
+		vector<bool> printed(n, false);
+		for(int u = 0; u < n; ++u){
+			if(printed[u]){ continue; }
+			cout << name_table[u];
+			for(int v = u + 1; v < n; ++v){
+				if(!reach[u].reachable(v)){ continue; }
+				if(!reach[v].reachable(u)){ continue; }
+				cout << ", " << name_table[v];
+				printed[v] = true;
+			}
+			cout << endl;
+		}
+	}
+	return 0;
+}
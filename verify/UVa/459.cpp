@@ -0,0 +1,42 @@
+// UVa 459 - Graph Connectivity
+#include <iostream>
+#include <vector>
+#include <string>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/vertex_ordering.hpp"
+
+using namespace std;
+typedef lc::Edge Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int T;
+	cin >> T;
+	for(int case_num = 0; case_num < T; ++case_num){
+		string line;
+		cin >> line;
+		const int n = line[0] - 'A' + 1;
+		lc::AdjacencyList<Edge> graph(n);
+		getline(cin, line);
+		while(getline(cin, line) && line.size() >= 2){
+			const int a = line[0] - 'A', b = line[1] - 'A';
+			graph.add_edge(a, b);
+			graph.add_edge(b, a);
+		}
+		// 深さ優先探索順では成分の先頭以外の頂点は
+		// 自身より小さい番号の隣接頂点 (探索木の親) を持つ
+		const vector<int> new_id = lc::depth_first_ordering(graph);
+		const auto relabeled = lc::relabel_vertices(graph, new_id);
+		int count = 0;
+		for(int u = 0; u < n; ++u){
+			bool head = true;
+			for(const auto &e : relabeled[u]){
+				if(e.to < u){ head = false; }
+			}
+			if(head){ ++count; }
+		}
+		if(case_num > 0){ cout << endl; }
+		cout << count << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,26 @@
+// UVa 558 - Wormholes
+#include <iostream>
+#include "libcomp/graph/edges.hpp"
+#include "libcomp/graph/sssp_spfa.hpp"
+
+using namespace std;
+typedef lc::EdgeWithWeight<int> Edge;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	int T;
+	cin >> T;
+	while(T--){
+		int n, m;
+		cin >> n >> m;
+		lc::AdjacencyList<Edge> graph(n);
+		for(int i = 0; i < m; ++i){
+			int x, y, t;
+			cin >> x >> y >> t;
+			graph.add_edge(x, y, t);
+		}
+		const auto cycle = lc::find_negative_cycle(graph);
+		cout << (cycle.empty() ? "not possible" : "possible") << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,42 @@
+// UVa 821 - Page Hopping
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <limits>
+#include "libcomp/graph/apsp_floyd_warshall.hpp"
+
+using namespace std;
+
+int main(){
+	ios_base::sync_with_stdio(false);
+	const int inf = numeric_limits<int>::max();
+	for(int case_num = 1; ; ++case_num){
+		int a, b;
+		cin >> a >> b;
+		if(a == 0 && b == 0){ break; }
+		lc::Matrix<int> adjacency(100, 100);
+		for(int i = 0; i < 100; ++i){
+			for(int j = 0; j < 100; ++j){ adjacency(i, j) = inf; }
+		}
+		vector<bool> used(100, false);
+		while(a != 0 || b != 0){
+			adjacency(a - 1, b - 1) = 1;
+			used[a - 1] = used[b - 1] = true;
+			cin >> a >> b;
+		}
+		const auto dist = lc::apsp_floyd_warshall(adjacency);
+		int sum = 0, count = 0;
+		for(int i = 0; i < 100; ++i){
+			if(!used[i]){ continue; }
+			for(int j = 0; j < 100; ++j){
+				if(i == j || !used[j]){ continue; }
+				sum += dist(i, j);
+				++count;
+			}
+		}
+		const double average = static_cast<double>(sum) / count;
+		cout << "Case " << case_num << ": average length between pages = ";
+		cout << fixed << setprecision(3) << average << " clicks" << endl;
+	}
+	return 0;
+}